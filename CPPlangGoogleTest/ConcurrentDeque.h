@@ -0,0 +1,295 @@
+#pragma once
+#include <iostream>
+#include <atomic>
+#include <mutex>
+#include <utility> // Для std::move
+
+/**
+ * @brief Потокобезопасная двусторонняя очередь с раздельными блокировками концов.
+ *
+ * Двусвязный список, у которого голова защищена одним мьютексом, а хвост — другим.
+ * Пока в очереди достаточно элементов, операции с разными концами затрагивают
+ * разные узлы и выполняются параллельно, каждая под своим мьютексом (быстрый путь).
+ * Когда элементов мало и концы могут совпасть, операция захватывает оба мьютекса
+ * (медленный путь).
+ *
+ * Извлечение на быстром пути сначала резервирует элемент, уменьшая атомарный счетчик
+ * size при условии size >= FAST_POP_MIN. Добавление увеличивает счетчик уже после
+ * привязки узла, поэтому size никогда не превышает число физически связанных узлов.
+ *
+ * @tparam T Тип хранимых данных. Должен быть копируемым.
+ */
+template<typename T>
+class ConcurrentDeque {
+private:
+    struct Node {
+        T data;
+        Node* prev;
+        Node* next;
+        explicit Node(const T& value) : data(value), prev(nullptr), next(nullptr) {}
+    };
+
+    /// При стольких элементах извлечение с одного конца не затрагивает узлы другого,
+    /// даже если с другого конца параллельно извлекается еще один элемент.
+    static constexpr size_t FAST_POP_MIN = 3;
+    /// При стольких элементах голова и хвост — разные узлы.
+    static constexpr size_t FAST_PUSH_MIN = 2;
+
+    // Концы разнесены по разным кэш-линиям, чтобы потоки не мешали друг другу
+    alignas(64) std::mutex head_mutex;
+    Node* head;
+    alignas(64) std::mutex tail_mutex;
+    Node* tail;
+    alignas(64) std::atomic<size_t> size;
+
+    bool reserveFast();
+    void linkFront(Node* node);
+    void linkBack(Node* node);
+    Node* unlinkFront();
+    Node* unlinkBack();
+
+public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустую очередь.
+     */
+    ConcurrentDeque();
+
+    ConcurrentDeque(const ConcurrentDeque&) = delete;
+    ConcurrentDeque& operator=(const ConcurrentDeque&) = delete;
+
+    /**
+     * @brief Деструктор. Освобождает все узлы.
+     */
+    ~ConcurrentDeque();
+
+    /**
+     * @brief Добавляет элемент в начало. Сложность: O(1).
+     * @param element Значение для добавления.
+     */
+    void pushFront(const T& element);
+
+    /**
+     * @brief Добавляет элемент в конец. Сложность: O(1).
+     * @param element Значение для добавления.
+     */
+    void pushBack(const T& element);
+
+    /**
+     * @brief Извлекает первый элемент.
+     * @param out Получает значение извлеченного элемента.
+     * @return true, если элемент извлечен; false, если очередь пуста.
+     */
+    bool tryPopFront(T& out);
+
+    /**
+     * @brief Извлекает последний элемент.
+     * @param out Получает значение извлеченного элемента.
+     * @return true, если элемент извлечен; false, если очередь пуста.
+     */
+    bool tryPopBack(T& out);
+
+    /**
+     * @brief Возвращает количество элементов.
+     * При одновременных изменениях значение приблизительное.
+     * @return Размер очереди.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуста ли очередь.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Удаляет все элементы. Захватывает оба мьютекса.
+     */
+    void clear();
+
+    /**
+     * @brief Выводит элементы очереди. Захватывает оба мьютекса.
+     * Формат: Front -> [e1, e2, e3] <- Back
+     */
+    void print();
+};
+
+template<typename T>
+ConcurrentDeque<T>::ConcurrentDeque() : head(nullptr), tail(nullptr), size(0) {}
+
+template<typename T>
+ConcurrentDeque<T>::~ConcurrentDeque() {
+    clear();
+}
+
+// Резервирует элемент для извлечения без захвата второго мьютекса.
+// Вызывается под мьютексом своего конца; false означает переход на медленный путь.
+template<typename T>
+bool ConcurrentDeque<T>::reserveFast() {
+    size_t current = size.load();
+    while (current >= FAST_POP_MIN) {
+        if (size.compare_exchange_weak(current, current - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void ConcurrentDeque<T>::linkFront(Node* node) {
+    node->next = head;
+    if (head) {
+        head->prev = node;
+    } else {
+        tail = node;
+    }
+    head = node;
+}
+
+template<typename T>
+void ConcurrentDeque<T>::linkBack(Node* node) {
+    node->prev = tail;
+    if (tail) {
+        tail->next = node;
+    } else {
+        head = node;
+    }
+    tail = node;
+}
+
+template<typename T>
+typename ConcurrentDeque<T>::Node* ConcurrentDeque<T>::unlinkFront() {
+    Node* node = head;
+    head = node->next;
+    if (head) {
+        head->prev = nullptr;
+    } else {
+        tail = nullptr;
+    }
+    return node;
+}
+
+template<typename T>
+typename ConcurrentDeque<T>::Node* ConcurrentDeque<T>::unlinkBack() {
+    Node* node = tail;
+    tail = node->prev;
+    if (tail) {
+        tail->next = nullptr;
+    } else {
+        head = nullptr;
+    }
+    return node;
+}
+
+template<typename T>
+void ConcurrentDeque<T>::pushFront(const T& element) {
+    Node* node = new Node(element); // выделение памяти вне критической секции
+    {
+        std::lock_guard<std::mutex> lock(head_mutex);
+        if (size.load() >= FAST_PUSH_MIN) {
+            linkFront(node);
+            size.fetch_add(1);
+            return;
+        }
+    }
+    std::scoped_lock lock(head_mutex, tail_mutex);
+    linkFront(node);
+    size.fetch_add(1);
+}
+
+template<typename T>
+void ConcurrentDeque<T>::pushBack(const T& element) {
+    Node* node = new Node(element);
+    {
+        std::lock_guard<std::mutex> lock(tail_mutex);
+        if (size.load() >= FAST_PUSH_MIN) {
+            linkBack(node);
+            size.fetch_add(1);
+            return;
+        }
+    }
+    std::scoped_lock lock(head_mutex, tail_mutex);
+    linkBack(node);
+    size.fetch_add(1);
+}
+
+template<typename T>
+bool ConcurrentDeque<T>::tryPopFront(T& out) {
+    Node* node = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(head_mutex);
+        if (reserveFast()) {
+            node = unlinkFront();
+        }
+    }
+    if (!node) {
+        std::scoped_lock lock(head_mutex, tail_mutex);
+        if (size.load() == 0) {
+            return false;
+        }
+        node = unlinkFront();
+        size.fetch_sub(1);
+    }
+    out = std::move(node->data);
+    delete node;
+    return true;
+}
+
+template<typename T>
+bool ConcurrentDeque<T>::tryPopBack(T& out) {
+    Node* node = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(tail_mutex);
+        if (reserveFast()) {
+            node = unlinkBack();
+        }
+    }
+    if (!node) {
+        std::scoped_lock lock(head_mutex, tail_mutex);
+        if (size.load() == 0) {
+            return false;
+        }
+        node = unlinkBack();
+        size.fetch_sub(1);
+    }
+    out = std::move(node->data);
+    delete node;
+    return true;
+}
+
+template<typename T>
+size_t ConcurrentDeque<T>::getSize() const {
+    return size.load();
+}
+
+template<typename T>
+bool ConcurrentDeque<T>::isEmpty() const {
+    return size.load() == 0;
+}
+
+template<typename T>
+void ConcurrentDeque<T>::clear() {
+    Node* current;
+    {
+        std::scoped_lock lock(head_mutex, tail_mutex);
+        current = head;
+        head = nullptr;
+        tail = nullptr;
+        size.store(0);
+    }
+    while (current) {
+        Node* next = current->next;
+        delete current;
+        current = next;
+    }
+}
+
+template<typename T>
+void ConcurrentDeque<T>::print() {
+    std::scoped_lock lock(head_mutex, tail_mutex);
+    std::cout << "Front -> [";
+    for (Node* current = head; current; current = current->next) {
+        std::cout << current->data;
+        if (current->next) std::cout << ", ";
+    }
+    std::cout << "] <- Back" << std::endl;
+}
@@ -0,0 +1,284 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include <utility> // Для std::swap
+
+/**
+ * @brief Очередь отложенных заданий (Delay Queue / Timer Queue).
+ *
+ * Элемент становится видимым только после наступления его срока (deadline).
+ * Реализована на основе двоичной кучи (min-heap) по сроку, хранящейся в непрерывном массиве,
+ * поэтому ещё не наступившие задания не перебираются при каждом опросе.
+ * Задания с одинаковым сроком извлекаются в порядке добавления (FIFO).
+ *
+ * Время задается в произвольных монотонных единицах (например, миллисекундах steady_clock).
+ *
+ * @tparam T Тип хранимых данных. Должен быть копируемым и конструируемым по умолчанию.
+ */
+template<typename T>
+class DelayQueue {
+public:
+    using TimePoint = uint64_t; ///< Момент времени в монотонных единицах
+
+private:
+    struct Entry {
+        TimePoint deadline;
+        uint64_t sequence; ///< Порядковый номер для стабильности при равных сроках
+        T value;
+    };
+
+    Entry* heap;
+    size_t capacity;
+    size_t size;
+    uint64_t next_sequence;
+
+    static bool earlier(const Entry& a, const Entry& b);
+    void grow();
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+    void popTop();
+
+public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустую очередь.
+     */
+    DelayQueue();
+
+    /**
+     * @brief Конструктор копирования.
+     * @param other Очередь для копирования.
+     */
+    DelayQueue(const DelayQueue& other);
+
+    /**
+     * @brief Оператор присваивания.
+     * Обеспечивает строгую гарантию безопасности исключений.
+     * @param other Очередь, содержимое которой присваивается.
+     * @return Ссылка на текущий объект.
+     */
+    DelayQueue& operator=(const DelayQueue& other);
+
+    /**
+     * @brief Деструктор. Освобождает буфер кучи.
+     */
+    ~DelayQueue();
+
+    /**
+     * @brief Планирует элемент к выдаче в момент deadline.
+     * Сложность: O(log N).
+     * @param value Значение для вставки.
+     * @param deadline Момент, начиная с которого элемент становится готовым.
+     */
+    void schedule(const T& value, TimePoint deadline);
+
+    /**
+     * @brief Пакетно извлекает готовые элементы (deadline <= now) в порядке сроков.
+     * Сложность: O(K log N), где K — количество извлеченных элементов.
+     * @param now Текущий момент времени.
+     * @param out Буфер для извлеченных элементов (не менее max ячеек).
+     * @param max Максимальное количество извлекаемых элементов.
+     * @return Количество записанных в out элементов.
+     */
+    size_t pollReady(TimePoint now, T* out, size_t max);
+
+    /**
+     * @brief Проверяет, есть ли готовые к выдаче элементы.
+     * @param now Текущий момент времени.
+     * @return true, если ближайший срок уже наступил.
+     */
+    bool hasReady(TimePoint now) const;
+
+    /**
+     * @brief Возвращает ближайший срок среди запланированных элементов.
+     * @return Момент времени ближайшего элемента.
+     * @throw std::runtime_error Если очередь пуста.
+     */
+    TimePoint nextDeadline() const;
+
+    /**
+     * @brief Возвращает элемент с ближайшим сроком (независимо от готовности).
+     * @return Константная ссылка на элемент.
+     * @throw std::runtime_error Если очередь пуста.
+     */
+    const T& front() const;
+
+    /**
+     * @brief Возвращает количество запланированных элементов.
+     * @return Размер очереди.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуста ли очередь.
+     * @return true, если элементов нет, иначе false.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Удаляет все элементы. Буфер кучи сохраняется.
+     */
+    void clear();
+
+    /**
+     * @brief Выводит пары (срок: значение) в порядке хранения в куче.
+     */
+    void print() const;
+};
+
+template<typename T>
+DelayQueue<T>::DelayQueue() : heap(nullptr), capacity(0), size(0), next_sequence(0) {}
+
+template<typename T>
+DelayQueue<T>::DelayQueue(const DelayQueue& other)
+    : heap(nullptr), capacity(other.capacity), size(other.size), next_sequence(other.next_sequence) {
+    if (capacity > 0) {
+        heap = new Entry[capacity];
+        for (size_t i = 0; i < size; ++i) {
+            heap[i] = other.heap[i];
+        }
+    }
+}
+
+template<typename T>
+DelayQueue<T>& DelayQueue<T>::operator=(const DelayQueue& other) {
+    if (this != &other) {
+        DelayQueue temp(other);
+        std::swap(heap, temp.heap);
+        std::swap(capacity, temp.capacity);
+        std::swap(size, temp.size);
+        std::swap(next_sequence, temp.next_sequence);
+    }
+    return *this;
+}
+
+template<typename T>
+DelayQueue<T>::~DelayQueue() {
+    delete[] heap;
+}
+
+template<typename T>
+bool DelayQueue<T>::earlier(const Entry& a, const Entry& b) {
+    if (a.deadline != b.deadline) return a.deadline < b.deadline;
+    return a.sequence < b.sequence;
+}
+
+template<typename T>
+void DelayQueue<T>::grow() {
+    size_t new_capacity = capacity == 0 ? 16 : capacity * 2;
+    Entry* new_heap = new Entry[new_capacity];
+    for (size_t i = 0; i < size; ++i) {
+        new_heap[i] = std::move(heap[i]);
+    }
+    delete[] heap;
+    heap = new_heap;
+    capacity = new_capacity;
+}
+
+template<typename T>
+void DelayQueue<T>::siftUp(size_t index) {
+    Entry item = std::move(heap[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!earlier(item, heap[parent])) break;
+        heap[index] = std::move(heap[parent]);
+        index = parent;
+    }
+    heap[index] = std::move(item);
+}
+
+template<typename T>
+void DelayQueue<T>::siftDown(size_t index) {
+    Entry item = std::move(heap[index]);
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= size) break;
+        if (child + 1 < size && earlier(heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if (!earlier(heap[child], item)) break;
+        heap[index] = std::move(heap[child]);
+        index = child;
+    }
+    heap[index] = std::move(item);
+}
+
+template<typename T>
+void DelayQueue<T>::popTop() {
+    --size;
+    if (size > 0) {
+        heap[0] = std::move(heap[size]);
+        siftDown(0);
+    }
+}
+
+template<typename T>
+void DelayQueue<T>::schedule(const T& value, TimePoint deadline) {
+    if (size >= capacity) {
+        grow();
+    }
+    heap[size].deadline = deadline;
+    heap[size].sequence = next_sequence++;
+    heap[size].value = value;
+    siftUp(size);
+    ++size;
+}
+
+template<typename T>
+size_t DelayQueue<T>::pollReady(TimePoint now, T* out, size_t max) {
+    size_t count = 0;
+    while (count < max && size > 0 && heap[0].deadline <= now) {
+        out[count++] = std::move(heap[0].value);
+        popTop();
+    }
+    return count;
+}
+
+template<typename T>
+bool DelayQueue<T>::hasReady(TimePoint now) const {
+    return size > 0 && heap[0].deadline <= now;
+}
+
+template<typename T>
+typename DelayQueue<T>::TimePoint DelayQueue<T>::nextDeadline() const {
+    if (size == 0) {
+        throw std::runtime_error("DelayQueue is empty");
+    }
+    return heap[0].deadline;
+}
+
+template<typename T>
+const T& DelayQueue<T>::front() const {
+    if (size == 0) {
+        throw std::runtime_error("DelayQueue is empty");
+    }
+    return heap[0].value;
+}
+
+template<typename T>
+size_t DelayQueue<T>::getSize() const {
+    return size;
+}
+
+template<typename T>
+bool DelayQueue<T>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T>
+void DelayQueue<T>::clear() {
+    for (size_t i = 0; i < size; ++i) {
+        heap[i].value = T();
+    }
+    size = 0;
+}
+
+template<typename T>
+void DelayQueue<T>::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < size; ++i) {
+        std::cout << heap[i].deadline << ": " << heap[i].value;
+        if (i + 1 < size) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
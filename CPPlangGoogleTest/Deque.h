@@ -0,0 +1,575 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include <utility> // Для std::swap, std::move
+
+/**
+ * @brief Двусторонняя очередь на блоках фиксированного размера (Chunked Deque).
+ *
+ * Элементы хранятся в блоках по BlockSize штук; центральная карта (map) хранит
+ * указатели на блоки. Вставка и удаление с обоих концов выполняются за O(1)
+ * амортизированно без выделения памяти на каждый элемент, доступ по индексу — за O(1).
+ * Внутри блока элементы лежат непрерывно, что дает быстрый последовательный обход
+ * (см. forEachBlock()).
+ *
+ * Позиция элемента i в "пространстве карты" равна start + i: номер блока — (start + i) / BlockSize,
+ * смещение — (start + i) % BlockSize. При нехватке места с любого края карта перестраивается
+ * с запасом по обе стороны.
+ *
+ * @tparam T Тип хранимых данных. Должен быть копируемым и конструируемым по умолчанию.
+ * @tparam BlockSize Размер блока в элементах, степень двойки.
+ * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
+ */
+template<typename T, size_t BlockSize = 64>
+class Deque {
+private:
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two");
+
+    T** map;           ///< Карта блоков; неиспользуемые ячейки равны nullptr
+    size_t mapSize;    ///< Количество ячеек карты
+    size_t start;      ///< Позиция первого элемента в пространстве карты
+    size_t size;       ///< Текущее количество элементов
+    T* spareBlock;     ///< Один освобожденный блок, сохраняемый для повторного использования
+
+    T* acquireBlock();
+    void releaseBlock(T* block);
+    void reserveMap(size_t frontBlocks, size_t backBlocks);
+    void recenterEmpty();
+    T& at(size_t position) const { return map[position / BlockSize][position % BlockSize]; }
+
+public:
+    /**
+     * @brief Итератор произвольного доступа. Хранит указатель на дек и индекс элемента.
+     * @tparam IsConst true для константного итератора.
+     */
+    template<bool IsConst>
+    class IteratorBase {
+    private:
+        using DequePtr = typename std::conditional<IsConst, const Deque*, Deque*>::type;
+        DequePtr deque;
+        size_t index;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        IteratorBase() : deque(nullptr), index(0) {}
+        IteratorBase(DequePtr owner, size_t i) : deque(owner), index(i) {}
+
+        reference operator*() const { return deque->at(deque->start + index); }
+        pointer operator->() const { return &deque->at(deque->start + index); }
+        reference operator[](difference_type n) const { return deque->at(deque->start + index + n); }
+
+        IteratorBase& operator++() { ++index; return *this; }
+        IteratorBase operator++(int) { IteratorBase copy = *this; ++index; return copy; }
+        IteratorBase& operator--() { --index; return *this; }
+        IteratorBase operator--(int) { IteratorBase copy = *this; --index; return copy; }
+        IteratorBase& operator+=(difference_type n) { index += n; return *this; }
+        IteratorBase& operator-=(difference_type n) { index -= n; return *this; }
+        IteratorBase operator+(difference_type n) const { return IteratorBase(deque, index + n); }
+        IteratorBase operator-(difference_type n) const { return IteratorBase(deque, index - n); }
+        difference_type operator-(const IteratorBase& other) const {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const IteratorBase& other) const { return index == other.index; }
+        bool operator!=(const IteratorBase& other) const { return index != other.index; }
+        bool operator<(const IteratorBase& other) const { return index < other.index; }
+        bool operator>(const IteratorBase& other) const { return index > other.index; }
+        bool operator<=(const IteratorBase& other) const { return index <= other.index; }
+        bool operator>=(const IteratorBase& other) const { return index >= other.index; }
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой дек без выделения памяти.
+     */
+    Deque();
+
+    /**
+     * @brief Копирующий конструктор.
+     * @param other Дек-источник.
+     */
+    Deque(const Deque& other);
+
+    /**
+     * @brief Оператор присваивания (copy-and-swap).
+     * @param other Дек-источник.
+     * @return Ссылка на текущий объект.
+     */
+    Deque& operator=(const Deque& other);
+
+    /**
+     * @brief Деструктор. Освобождает блоки и карту.
+     */
+    ~Deque();
+
+    /**
+     * @brief Добавляет элемент в начало. Сложность: O(1) амортизированно.
+     * @param element Значение для добавления.
+     */
+    void pushFront(const T& element);
+
+    /**
+     * @brief Добавляет элемент в конец. Сложность: O(1) амортизированно.
+     * @param element Значение для добавления.
+     */
+    void pushBack(const T& element);
+
+    /**
+     * @brief Удаляет первый элемент. Сложность: O(1).
+     * @throw std::runtime_error Если дек пуст.
+     */
+    void popFront();
+
+    /**
+     * @brief Удаляет последний элемент. Сложность: O(1).
+     * @throw std::runtime_error Если дек пуст.
+     */
+    void popBack();
+
+    /**
+     * @brief Возвращает ссылку на элемент по индексу. Сложность: O(1).
+     * @param index Индекс элемента.
+     * @return T& Ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    T& get(size_t index);
+
+    /**
+     * @brief Возвращает константную ссылку на элемент по индексу.
+     * @param index Индекс элемента.
+     * @return const T& Константная ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    const T& get(size_t index) const;
+
+    /**
+     * @brief Оператор доступа по индексу (с проверкой границ).
+     * @param index Индекс элемента.
+     * @return T& Ссылка на элемент.
+     */
+    T& operator[](size_t index);
+
+    /**
+     * @brief Возвращает первый элемент.
+     * @throw std::runtime_error Если дек пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает последний элемент.
+     * @throw std::runtime_error Если дек пуст.
+     */
+    T& back();
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size); }
+
+    /**
+     * @brief Обходит элементы по непрерывным участкам блоков.
+     * @param func Функция вида void(const T* data, size_t count), вызываемая для каждого участка.
+     */
+    template<typename Func>
+    void forEachBlock(Func func) const;
+
+    /**
+     * @brief Возвращает количество элементов.
+     * @return Размер дека.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли дек.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Удаляет все элементы и освобождает блоки. Карта сохраняется.
+     */
+    void clear();
+
+    /**
+     * @brief Линейный поиск значения.
+     * @param value Искомое значение.
+     * @return true, если значение найдено.
+     */
+    bool find(const T& value) const;
+
+    /**
+     * @brief Выводит элементы дека. Формат: Front -> [e1, e2, e3] <- Back
+     */
+    void print() const;
+
+    /**
+     * @brief Сериализация (обертка над serializeBinary).
+     * @param out Поток вывода.
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Десериализация (обертка над deserializeBinary).
+     * @param in Поток ввода.
+     */
+    void deserialize(std::istream& in);
+
+    /**
+     * @brief Бинарная сериализация: размер и значения по порядку.
+     * @warning Только для POD-типов.
+     * @param out Поток вывода.
+     */
+    void serializeBinary(std::ostream& out) const;
+
+    /**
+     * @brief Бинарная десериализация. Очищает дек и восстанавливает элементы.
+     * @warning Только для POD-типов.
+     * @param in Поток ввода.
+     */
+    void deserializeBinary(std::istream& in);
+
+    /**
+     * @brief Текстовая сериализация. Формат: <размер>\n<значения через пробел>\n
+     * @param out Поток вывода.
+     */
+    void serializeText(std::ostream& out) const;
+
+    /**
+     * @brief Текстовая десериализация.
+     * @param in Поток ввода.
+     */
+    void deserializeText(std::istream& in);
+};
+
+template<typename T, size_t BlockSize>
+Deque<T, BlockSize>::Deque() : map(nullptr), mapSize(0), start(0), size(0), spareBlock(nullptr) {}
+
+template<typename T, size_t BlockSize>
+Deque<T, BlockSize>::Deque(const Deque& other) : map(nullptr), mapSize(0), start(0), size(0), spareBlock(nullptr) {
+    try {
+        other.forEachBlock([this](const T* data, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                pushBack(data[i]);
+            }
+        });
+    } catch (...) {
+        clear();
+        delete[] spareBlock;
+        delete[] map;
+        throw;
+    }
+}
+
+template<typename T, size_t BlockSize>
+Deque<T, BlockSize>& Deque<T, BlockSize>::operator=(const Deque& other) {
+    if (this != &other) {
+        Deque temp(other);
+        std::swap(map, temp.map);
+        std::swap(mapSize, temp.mapSize);
+        std::swap(start, temp.start);
+        std::swap(size, temp.size);
+        std::swap(spareBlock, temp.spareBlock);
+    }
+    return *this;
+}
+
+template<typename T, size_t BlockSize>
+Deque<T, BlockSize>::~Deque() {
+    clear();
+    delete[] spareBlock;
+    delete[] map;
+}
+
+template<typename T, size_t BlockSize>
+T* Deque<T, BlockSize>::acquireBlock() {
+    if (spareBlock) {
+        T* block = spareBlock;
+        spareBlock = nullptr;
+        return block;
+    }
+    return new T[BlockSize];
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::releaseBlock(T* block) {
+    // Один блок держим в запасе, чтобы чередование push/pop на границе не выделяло память
+    if (!spareBlock) {
+        spareBlock = block;
+    } else {
+        delete[] block;
+    }
+}
+
+// Гарантирует, что перед первым занятым блоком есть frontBlocks свободных ячеек карты,
+// а после последнего — backBlocks. При перестройке блоки центрируются.
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::reserveMap(size_t frontBlocks, size_t backBlocks) {
+    size_t firstBlock = start / BlockSize;
+    size_t usedBlocks = size == 0 ? 0 : (start + size - 1) / BlockSize - firstBlock + 1;
+    size_t lastBlock = firstBlock + usedBlocks; // за последним занятым
+    if (map && firstBlock >= frontBlocks && lastBlock + backBlocks <= mapSize) {
+        return;
+    }
+
+    size_t needed = usedBlocks + frontBlocks + backBlocks;
+    size_t newMapSize = mapSize < 8 ? 8 : mapSize;
+    while (newMapSize < 2 * needed) {
+        newMapSize *= 2;
+    }
+    T** newMap = new T*[newMapSize]();
+    size_t newFirst = (newMapSize - usedBlocks) / 2;
+    for (size_t i = 0; i < usedBlocks; ++i) {
+        newMap[newFirst + i] = map[firstBlock + i];
+    }
+    delete[] map;
+    map = newMap;
+    mapSize = newMapSize;
+    start = newFirst * BlockSize + start % BlockSize;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::recenterEmpty() {
+    if (!map) {
+        reserveMap(1, 1);
+    }
+    // Пустой дек: начинаем с середины карты и блока, чтобы расти в обе стороны
+    start = mapSize / 2 * BlockSize + BlockSize / 2;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::pushBack(const T& element) {
+    if (size == 0) {
+        recenterEmpty();
+    } else if ((start + size) / BlockSize >= mapSize) {
+        reserveMap(0, 1);
+    }
+    size_t position = start + size;
+    T*& block = map[position / BlockSize];
+    bool fresh = block == nullptr;
+    if (fresh) {
+        block = acquireBlock();
+    }
+    try {
+        block[position % BlockSize] = element;
+    } catch (...) {
+        if (fresh) {
+            releaseBlock(block);
+            block = nullptr;
+        }
+        throw;
+    }
+    ++size;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::pushFront(const T& element) {
+    if (size == 0) {
+        recenterEmpty();
+    } else if (start == 0) {
+        reserveMap(1, 0);
+    }
+    size_t position = start - 1;
+    T*& block = map[position / BlockSize];
+    bool fresh = block == nullptr;
+    if (fresh) {
+        block = acquireBlock();
+    }
+    try {
+        block[position % BlockSize] = element;
+    } catch (...) {
+        if (fresh) {
+            releaseBlock(block);
+            block = nullptr;
+        }
+        throw;
+    }
+    start = position;
+    ++size;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::popFront() {
+    if (size == 0) {
+        throw std::runtime_error("Deque is empty");
+    }
+    at(start) = T();
+    ++start;
+    --size;
+    // Блок опустел: первый элемент ушел за его границу (или дек стал пустым)
+    if (start % BlockSize == 0 || size == 0) {
+        size_t block = (start - 1) / BlockSize;
+        releaseBlock(map[block]);
+        map[block] = nullptr;
+    }
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::popBack() {
+    if (size == 0) {
+        throw std::runtime_error("Deque is empty");
+    }
+    size_t position = start + size - 1;
+    at(position) = T();
+    --size;
+    if (position % BlockSize == 0 || size == 0) {
+        size_t block = position / BlockSize;
+        releaseBlock(map[block]);
+        map[block] = nullptr;
+    }
+}
+
+template<typename T, size_t BlockSize>
+T& Deque<T, BlockSize>::get(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return at(start + index);
+}
+
+template<typename T, size_t BlockSize>
+const T& Deque<T, BlockSize>::get(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return at(start + index);
+}
+
+template<typename T, size_t BlockSize>
+T& Deque<T, BlockSize>::operator[](size_t index) {
+    return get(index);
+}
+
+template<typename T, size_t BlockSize>
+T& Deque<T, BlockSize>::front() {
+    if (size == 0) {
+        throw std::runtime_error("Deque is empty");
+    }
+    return at(start);
+}
+
+template<typename T, size_t BlockSize>
+T& Deque<T, BlockSize>::back() {
+    if (size == 0) {
+        throw std::runtime_error("Deque is empty");
+    }
+    return at(start + size - 1);
+}
+
+template<typename T, size_t BlockSize>
+template<typename Func>
+void Deque<T, BlockSize>::forEachBlock(Func func) const {
+    size_t position = start;
+    size_t remaining = size;
+    while (remaining > 0) {
+        size_t offset = position % BlockSize;
+        size_t count = BlockSize - offset;
+        if (count > remaining) count = remaining;
+        func(map[position / BlockSize] + offset, count);
+        position += count;
+        remaining -= count;
+    }
+}
+
+template<typename T, size_t BlockSize>
+size_t Deque<T, BlockSize>::getSize() const {
+    return size;
+}
+
+template<typename T, size_t BlockSize>
+bool Deque<T, BlockSize>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::clear() {
+    for (size_t i = 0; i < mapSize; ++i) {
+        delete[] map[i];
+        map[i] = nullptr;
+    }
+    start = mapSize / 2 * BlockSize;
+    size = 0;
+}
+
+template<typename T, size_t BlockSize>
+bool Deque<T, BlockSize>::find(const T& value) const {
+    bool found = false;
+    forEachBlock([&](const T* data, size_t count) {
+        for (size_t i = 0; i < count && !found; ++i) {
+            if (data[i] == value) found = true;
+        }
+    });
+    return found;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::print() const {
+    std::cout << "Front -> [";
+    for (size_t i = 0; i < size; ++i) {
+        std::cout << at(start + i);
+        if (i + 1 < size) std::cout << ", ";
+    }
+    std::cout << "] <- Back" << std::endl;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::serialize(std::ostream& out) const {
+    serializeBinary(out);
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::deserialize(std::istream& in) {
+    deserializeBinary(in);
+}
+
+// Важно: бинарная сериализация корректна только для тривиально копируемых типов.
+// Участки блоков непрерывны, поэтому записываются одним вызовом write.
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::serializeBinary(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    forEachBlock([&out](const T* data, size_t count) {
+        out.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    });
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::deserializeBinary(std::istream& in) {
+    clear();
+    size_t new_size;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        pushBack(value);
+    }
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::serializeText(std::ostream& out) const {
+    out << size << std::endl;
+    for (size_t i = 0; i < size; ++i) {
+        out << at(start + i);
+        if (i + 1 < size) out << " ";
+    }
+    out << std::endl;
+}
+
+template<typename T, size_t BlockSize>
+void Deque<T, BlockSize>::deserializeText(std::istream& in) {
+    clear();
+    size_t new_size;
+    in >> new_size;
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in >> value;
+        pushBack(value);
+    }
+}
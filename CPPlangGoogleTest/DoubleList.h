@@ -1,17 +1,28 @@
 #pragma once
 #include <iostream>
 #include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include "NodePool.h"
 
 /**
  * @brief Класс двусвязного списка.
  * 
  * Поддерживает вставку и удаление элементов с обоих концов за O(1),
  * а также доступ и модификацию по индексу за O(N).
+ * Список запоминает последний найденный по индексу узел ("палец"), поэтому
+ * обращения к соседним индексам выполняются за O(расстояние до предыдущего).
+ * Палец обновляют только неконстантные операции: константные методы ничего не
+ * записывают, и их можно одновременно вызывать из разных потоков.
+ * Для линейных алгоритмов предназначены двунаправленные итераторы: вставка и
+ * удаление по итератору выполняются за O(1).
  * 
  * @tparam T Тип элементов списка. Должен быть копируемым и конструируемым по умолчанию.
+ * @tparam Alloc Политика выделения узлов: DefaultNodeAllocator (new/delete)
+ *               или PooledNodeAllocator<> (переиспользование узлов через NodePool).
  * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
  */
-template<typename T>
+template<typename T, typename Alloc = DefaultNodeAllocator>
 class DoubleList {
 private:
     struct Node {
@@ -24,8 +35,80 @@ private:
     Node* head; ///< Указатель на первый элемент
     Node* tail; ///< Указатель на последний элемент
     size_t size; ///< Текущее количество элементов
+    Node* finger;        ///< Последний найденный по индексу узел (nullptr - нет)
+    size_t fingerIndex;  ///< Индекс узла finger
+
+    Node* walk(size_t index) const;
+    Node* locate(size_t index);
+    void resetFinger();
+    static Node* splitAfter(Node* start, size_t count);
+    static Node* mergeChains(Node* a, Node* b);
+    void relinkPrev();
+    void unlink(Node* node);
 
 public:
+    /**
+     * @brief Двунаправленный итератор списка.
+     * Хранит указатель на список, чтобы --end() указывал на последний элемент.
+     * @tparam IsConst true для константного итератора.
+     */
+    template<bool IsConst>
+    class IteratorBase {
+    private:
+        Node* node;
+        const DoubleList* list;
+        friend class DoubleList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        IteratorBase() : node(nullptr), list(nullptr) {}
+        IteratorBase(Node* n, const DoubleList* owner) : node(n), list(owner) {}
+
+        /// Неявное преобразование iterator -> const_iterator.
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& other) : node(other.node), list(other.list) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+
+        IteratorBase& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase copy = *this;
+            node = node->next;
+            return copy;
+        }
+
+        IteratorBase& operator--() {
+            node = node ? node->prev : list->tail;
+            return *this;
+        }
+
+        IteratorBase operator--(int) {
+            IteratorBase copy = *this;
+            --*this;
+            return copy;
+        }
+
+        bool operator==(const IteratorBase& other) const { return node == other.node; }
+        bool operator!=(const IteratorBase& other) const { return node != other.node; }
+
+        template<bool> friend class IteratorBase;
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     /**
      * @brief Конструктор по умолчанию.
      * Создает пустой список.
@@ -81,6 +164,26 @@ public:
      */
     void insert(size_t index, const T& element);
 
+    /**
+     * @brief Вставляет элемент перед позицией итератора.
+     * Сложность: O(1).
+     * 
+     * @param pos Итератор на элемент или end().
+     * @param element Добавляемое значение.
+     * @return Итератор на вставленный элемент.
+     */
+    iterator insert(const_iterator pos, const T& element);
+
+    /**
+     * @brief Удаляет элемент по итератору.
+     * Сложность: O(1).
+     * 
+     * @param pos Итератор на существующий элемент.
+     * @return Итератор на следующий элемент (или end()).
+     * @throw std::out_of_range Если pos == end().
+     */
+    iterator erase(const_iterator pos);
+
     /**
      * @brief Удаляет первый элемент списка.
      * Сложность: O(1).
@@ -114,9 +217,83 @@ public:
      */
     void removeValue(const T& value);
 
+    /**
+     * @brief Удаляет все элементы, удовлетворяющие предикату, за один проход.
+     * Отцепленные узлы освобождаются одним пакетом через Alloc::destroyChain.
+     * 
+     * @param pred Унарный предикат bool(const T&).
+     * @return Количество удаленных элементов.
+     */
+    template<typename Predicate>
+    size_t removeIf(Predicate pred);
+
+    /**
+     * @brief Разделяет список по предикату без выделения памяти.
+     * Элементы, не удовлетворяющие pred, переносятся в конец rejected
+     * с сохранением относительного порядка.
+     * 
+     * @param pred Унарный предикат bool(const T&).
+     * @param rejected Список-приемник.
+     * @return Количество перенесенных элементов.
+     */
+    template<typename Predicate>
+    size_t partition(Predicate pred, DoubleList& rejected);
+
+    /**
+     * @brief Переносит все элементы other в позицию index без выделения памяти.
+     * Перепривязка узлов выполняется за O(1); поиск позиции — O(min(index, size - index)).
+     * 
+     * @param index Позиция вставки (0 - перед первым, size - после последнего).
+     * @param other Список-источник (становится пустым).
+     * @throw std::out_of_range Если index > size.
+     */
+    void splice(size_t index, DoubleList& other);
+
+    /**
+     * @brief Переносит все элементы other перед позицией pos.
+     * Сложность: O(1), без выделения памяти.
+     * 
+     * @param pos Итератор текущего списка (или end()).
+     * @param other Список-источник (становится пустым).
+     */
+    void splice(const_iterator pos, DoubleList& other);
+
+    /**
+     * @brief Переносит элементы other из интервала [first, last) перед позицией pos.
+     * Узлы перепривязываются без выделения памяти; подсчет размера занимает O(K),
+     * где K — количество перенесенных элементов.
+     * 
+     * @param pos Итератор текущего списка (или end()).
+     * @param other Список-источник, которому принадлежат first и last.
+     * @param first Начало интервала.
+     * @param last Конец интервала (не включается).
+     */
+    void splice(const_iterator pos, DoubleList& other, const_iterator first, const_iterator last);
+
+    /**
+     * @brief Устойчивая сортировка слиянием "снизу вверх" без рекурсии.
+     * Перепривязывает узлы, не выделяя памяти. Сложность: O(N log N), доп. память O(1).
+     * Требует operator< для T.
+     */
+    void sort();
+
+    /**
+     * @brief Сливает отсортированный список other в текущий отсортированный список.
+     * Устойчиво: при равенстве элементы текущего списка идут первыми.
+     * 
+     * @param other Список-источник (становится пустым).
+     */
+    void merge(DoubleList& other);
+
+    /**
+     * @brief Удаляет подряд идущие повторяющиеся элементы, оставляя первый из каждой группы.
+     * @return Количество удаленных элементов.
+     */
+    size_t unique();
+
     /**
      * @brief Возвращает ссылку на элемент по индексу.
-     * Оптимизирован: выбирает направление перебора (от начала или от конца).
+     * Оптимизирован: начинает перебор с ближайшей точки (начало, конец или палец).
      * 
      * @param index Индекс элемента.
      * @return T& Ссылка на элемент.
@@ -126,7 +303,8 @@ public:
 
     /**
      * @brief Возвращает константную ссылку на элемент по индексу.
-     * Оптимизирован: выбирает направление перебора (от начала или от конца).
+     * Начинает перебор с ближайшей точки (начало, конец или палец), но палец не
+     * переставляет, поэтому безопасен при одновременных константных обращениях.
      * 
      * @param index Индекс элемента.
      * @return const T& Константная ссылка на элемент.
@@ -162,6 +340,40 @@ public:
      */
     const T& back() const;
 
+    /**
+     * @brief Итератор на первый элемент.
+     * @return iterator Начало списка.
+     */
+    iterator begin() { return iterator(head, this); }
+
+    /**
+     * @brief Итератор за последним элементом.
+     * @return iterator Конец списка.
+     */
+    iterator end() { return iterator(nullptr, this); }
+
+    const_iterator begin() const { return const_iterator(head, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const { return const_iterator(head, this); }
+    const_iterator cend() const { return const_iterator(nullptr, this); }
+
+    /**
+     * @brief Обратный итератор на последний элемент.
+     * @return reverse_iterator Начало обратного обхода.
+     */
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+    /**
+     * @brief Обратный итератор перед первым элементом.
+     * @return reverse_iterator Конец обратного обхода.
+     */
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(cend()); }
+    const_reverse_iterator crend() const { return const_reverse_iterator(cbegin()); }
+
     /**
      * @brief Возвращает текущее количество элементов.
      * @return size_t Размер списка.
@@ -249,11 +461,12 @@ public:
     void deserializeText(std::istream& in);
 };
 
-template<typename T>
-DoubleList<T>::DoubleList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename T, typename Alloc>
+DoubleList<T, Alloc>::DoubleList() : head(nullptr), tail(nullptr), size(0), finger(nullptr), fingerIndex(0) {}
 
-template<typename T>
-DoubleList<T>::DoubleList(const DoubleList& other) : head(nullptr), tail(nullptr), size(0) {
+template<typename T, typename Alloc>
+DoubleList<T, Alloc>::DoubleList(const DoubleList& other)
+    : head(nullptr), tail(nullptr), size(0), finger(nullptr), fingerIndex(0) {
     Node* current = other.head;
     while (current) {
         pushBack(current->data);
@@ -261,8 +474,8 @@ DoubleList<T>::DoubleList(const DoubleList& other) : head(nullptr), tail(nullptr
     }
 }
 
-template<typename T>
-DoubleList<T>& DoubleList<T>::operator=(const DoubleList& other) {
+template<typename T, typename Alloc>
+DoubleList<T, Alloc>& DoubleList<T, Alloc>::operator=(const DoubleList& other) {
     if (this != &other) {
         // Создаем копию во временном объекте (Copy-and-Swap idiom)
         // Если здесь вылетит исключение, текущий объект (this) не пострадает
@@ -272,20 +485,22 @@ DoubleList<T>& DoubleList<T>::operator=(const DoubleList& other) {
         Node* tHead = head; head = temp.head; temp.head = tHead;
         Node* tTail = tail; tail = temp.tail; temp.tail = tTail;
         size_t tSize = size; size = temp.size; temp.size = tSize;
+        resetFinger();
+        temp.resetFinger();
         
         // Деструктор temp очистит старые данные this
     }
     return *this;
 }
 
-template<typename T>
-DoubleList<T>::~DoubleList() {
+template<typename T, typename Alloc>
+DoubleList<T, Alloc>::~DoubleList() {
     clear();
 }
 
-template<typename T>
-void DoubleList<T>::pushFront(const T& element) {
-    Node* newNode = new Node(element);
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::pushFront(const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
     if (!head) {
         head = tail = newNode;
     } else {
@@ -294,11 +509,12 @@ void DoubleList<T>::pushFront(const T& element) {
         head = newNode;
     }
     ++size;
+    if (finger) ++fingerIndex;
 }
 
-template<typename T>
-void DoubleList<T>::pushBack(const T& element) {
-    Node* newNode = new Node(element);
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::pushBack(const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
     if (!tail) {
         head = tail = newNode;
     } else {
@@ -309,8 +525,8 @@ void DoubleList<T>::pushBack(const T& element) {
     ++size;
 }
 
-template<typename T>
-void DoubleList<T>::insert(size_t index, const T& element) {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::insert(size_t index, const T& element) {
     if (index > size) {
         throw std::out_of_range("Index out of range");
     }
@@ -323,32 +539,20 @@ void DoubleList<T>::insert(size_t index, const T& element) {
         return;
     }
 
-    Node* newNode = new Node(element);
-    Node* current;
-
-    if (index <= size / 2) {
-        current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-    } else {
-        current = tail;
-        // Идем с конца: нам нужен элемент, который СЕЙЧАС стоит на позиции index.
-        // tail имеет индекс size-1. Чтобы попасть на index, нужно сделать (size - 1 - index) шагов назад.
-        for (size_t i = 0; i < size - 1 - index; ++i) {
-            current = current->prev;
-        }
-    }
+    // Нужен элемент, который СЕЙЧАС стоит на позиции index; новый узел встает перед ним
+    Node* current = locate(index);
+    Node* newNode = Alloc::template create<Node>(element);
 
     newNode->next = current;
     newNode->prev = current->prev;
     current->prev->next = newNode;
     current->prev = newNode;
     ++size;
+    finger = newNode; // индекс index теперь принадлежит новому узлу
 }
 
-template<typename T>
-void DoubleList<T>::popFront() {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::popFront() {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
@@ -359,12 +563,14 @@ void DoubleList<T>::popFront() {
         head = head->next;
         head->prev = nullptr;
     }
-    delete temp;
+    if (finger == temp) resetFinger();
+    else if (finger) --fingerIndex;
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-void DoubleList<T>::popBack() {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::popBack() {
     if (!tail) {
         throw std::runtime_error("List is empty");
     }
@@ -375,12 +581,13 @@ void DoubleList<T>::popBack() {
         tail = tail->prev;
         tail->next = nullptr;
     }
-    delete temp;
+    if (finger == temp) resetFinger();
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-void DoubleList<T>::remove(size_t index) {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::remove(size_t index) {
     if (index >= size) {
         throw std::out_of_range("Index out of range");
     }
@@ -393,148 +600,413 @@ void DoubleList<T>::remove(size_t index) {
         return;
     }
 
-    Node* current;
-    if (index <= size / 2) {
-        current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
-    } else {
-        current = tail;
-        for (size_t i = 0; i < size - 1 - index; ++i) {
-            current = current->prev;
-        }
-    }
-
+    Node* current = locate(index);
     current->prev->next = current->next;
     current->next->prev = current->prev;
-    delete current;
+    finger = current->next; // следующий узел занимает освободившийся индекс
+    Alloc::destroy(current);
+    --size;
+}
+
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::iterator DoubleList<T, Alloc>::insert(const_iterator pos, const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
+    Node* next = pos.node;
+    Node* prev = next ? next->prev : tail;
+    newNode->next = next;
+    newNode->prev = prev;
+    if (prev) prev->next = newNode;
+    else head = newNode;
+    if (next) next->prev = newNode;
+    else tail = newNode;
+    ++size;
+    resetFinger(); // индекс позиции неизвестен
+    return iterator(newNode, this);
+}
+
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::iterator DoubleList<T, Alloc>::erase(const_iterator pos) {
+    if (!pos.node) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    Node* next = pos.node->next;
+    resetFinger();
+    unlink(pos.node);
+    Alloc::destroy(pos.node);
+    return iterator(next, this);
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::removeValue(const T& value) {
+    removeIf([&value](const T& element) { return element == value; });
+}
+
+// Отцепляет узел, сохраняя связность соседей
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::unlink(Node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else tail = node->prev;
+    node->next = node->prev = nullptr;
     --size;
 }
 
-template<typename T>
-void DoubleList<T>::removeValue(const T& value) {
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t DoubleList<T, Alloc>::removeIf(Predicate pred) {
+    resetFinger();
+    Node* removedHead = nullptr; // отцепленные узлы, освобождаемые пакетом
+    Node* removedTail = nullptr;
+    size_t removed = 0;
     Node* current = head;
-    while (current) {
-        if (current->data == value) {
-            Node* temp = current;
-            current = current->next;
-
-            if (temp == head && temp == tail) {
-                head = tail = nullptr;
-            } else if (temp == head) {
-                head = head->next;
-                head->prev = nullptr;
-            } else if (temp == tail) {
-                tail = tail->prev;
-                tail->next = nullptr;
-            } else {
-                temp->prev->next = temp->next;
-                temp->next->prev = temp->prev;
+    try {
+        while (current) {
+            Node* next = current->next;
+            if (pred(current->data)) {
+                unlink(current);
+                if (removedTail) removedTail->next = current;
+                else removedHead = current;
+                removedTail = current;
+                ++removed;
             }
-            delete temp;
-            --size;
-        } else {
-            current = current->next;
+            current = next;
         }
+    } catch (...) {
+        Alloc::destroyChain(removedHead);
+        throw;
     }
+    Alloc::destroyChain(removedHead);
+    return removed;
 }
 
-template<typename T>
-T& DoubleList<T>::get(size_t index) {
-    if (index >= size) {
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t DoubleList<T, Alloc>::partition(Predicate pred, DoubleList& rejected) {
+    if (&rejected == this) return 0;
+
+    resetFinger();
+    rejected.resetFinger();
+    size_t moved = 0;
+    Node* current = head;
+    while (current) {
+        Node* next = current->next;
+        if (!pred(current->data)) {
+            unlink(current);
+            current->prev = rejected.tail;
+            if (rejected.tail) rejected.tail->next = current;
+            else rejected.head = current;
+            rejected.tail = current;
+            ++rejected.size;
+            ++moved;
+        }
+        current = next;
+    }
+    return moved;
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::splice(size_t index, DoubleList& other) {
+    if (index > size) {
         throw std::out_of_range("Index out of range");
     }
-    Node* current;
-    if (index <= size / 2) {
-        current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
+    if (&other == this || !other.head) return;
+
+    // Узел, после которого вставляем (nullptr — в начало)
+    Node* before = index == 0 ? nullptr : locate(index - 1);
+    Node* after = before ? before->next : head;
+    other.head->prev = before;
+    other.tail->next = after;
+    if (before) before->next = other.head;
+    else head = other.head;
+    if (after) after->prev = other.tail;
+    else tail = other.tail;
+
+    if (!before && finger) fingerIndex += other.size;
+    size += other.size;
+    other.head = other.tail = nullptr;
+    other.size = 0;
+    other.resetFinger();
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::splice(const_iterator pos, DoubleList& other) {
+    if (&other == this || !other.head) return;
+    splice(pos, other, other.cbegin(), other.cend());
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::splice(const_iterator pos, DoubleList& other,
+                                  const_iterator first, const_iterator last) {
+    if (first == last) return;
+
+    // Последний узел интервала и количество переносимых элементов
+    Node* rangeHead = first.node;
+    Node* rangeTail = last.node ? last.node->prev : other.tail;
+    size_t count = 0;
+    if (&other == this) {
+        count = 0; // размер не меняется
+    } else if (rangeHead == other.head && !last.node) {
+        count = other.size;
     } else {
-        current = tail;
-        for (size_t i = 0; i < size - 1 - index; ++i) {
-            current = current->prev;
+        for (Node* current = rangeHead; current != last.node; current = current->next) {
+            ++count;
         }
     }
-    return current->data;
+
+    // Вырезаем [first, last) из other
+    if (rangeHead->prev) rangeHead->prev->next = last.node;
+    else other.head = last.node;
+    if (last.node) last.node->prev = rangeHead->prev;
+    else other.tail = rangeHead->prev;
+    other.size -= count;
+
+    // Вставляем перед pos
+    Node* next = pos.node;
+    Node* prev = next ? next->prev : tail;
+    rangeHead->prev = prev;
+    rangeTail->next = next;
+    if (prev) prev->next = rangeHead;
+    else head = rangeHead;
+    if (next) next->prev = rangeTail;
+    else tail = rangeTail;
+    size += count;
+
+    resetFinger();
+    other.resetFinger();
 }
 
-template<typename T>
-const T& DoubleList<T>::get(size_t index) const {
-    if (index >= size) {
-        throw std::out_of_range("Index out of range");
+// Отрезает цепочку после count узлов, начиная со start; возвращает остаток.
+// Поля prev в процессе сортировки не поддерживаются и восстанавливаются relinkPrev().
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::Node* DoubleList<T, Alloc>::splitAfter(Node* start, size_t count) {
+    for (size_t i = 1; start && i < count; ++i) {
+        start = start->next;
     }
-    Node* current;
-    if (index <= size / 2) {
-        current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
+    if (!start) return nullptr;
+    Node* rest = start->next;
+    start->next = nullptr;
+    return rest;
+}
+
+// Сливает две отсортированные цепочки по полям next; при равенстве первым идет элемент из a
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::Node* DoubleList<T, Alloc>::mergeChains(Node* a, Node* b) {
+    Node* result = nullptr;
+    Node* last = nullptr;
+    while (a && b) {
+        Node* taken;
+        if (b->data < a->data) {
+            taken = b;
+            b = b->next;
+        } else {
+            taken = a;
+            a = a->next;
         }
-    } else {
+        if (last) last->next = taken;
+        else result = taken;
+        last = taken;
+    }
+    Node* remainder = a ? a : b;
+    if (last) last->next = remainder;
+    else result = remainder;
+    return result;
+}
+
+// Восстанавливает поля prev и указатель на хвост за один проход от головы
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::relinkPrev() {
+    Node* prev = nullptr;
+    for (Node* current = head; current; current = current->next) {
+        current->prev = prev;
+        prev = current;
+    }
+    tail = prev;
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::sort() {
+    if (size < 2) return;
+    resetFinger();
+
+    for (size_t width = 1; width < size; width *= 2) {
+        Node* rest = head;
+        Node* newHead = nullptr;
+        Node* newTail = nullptr;
+        while (rest) {
+            Node* left = rest;
+            Node* right = splitAfter(left, width);
+            rest = splitAfter(right, width);
+
+            Node* merged = mergeChains(left, right);
+            if (newTail) newTail->next = merged;
+            else newHead = merged;
+
+            // Хвост слитого отрезка: не более 2 * width шагов
+            newTail = merged;
+            while (newTail->next) {
+                newTail = newTail->next;
+            }
+        }
+        head = newHead;
+    }
+    relinkPrev();
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::merge(DoubleList& other) {
+    if (&other == this || !other.head) return;
+
+    resetFinger();
+    other.resetFinger();
+    head = mergeChains(head, other.head);
+    relinkPrev();
+    size += other.size;
+    other.head = other.tail = nullptr;
+    other.size = 0;
+}
+
+template<typename T, typename Alloc>
+size_t DoubleList<T, Alloc>::unique() {
+    resetFinger();
+    size_t removed = 0;
+    Node* current = head;
+    while (current && current->next) {
+        Node* next = current->next;
+        if (next->data == current->data) {
+            current->next = next->next;
+            if (next->next) next->next->prev = current;
+            else tail = current;
+            Alloc::destroy(next);
+            ++removed;
+        } else {
+            current = next;
+        }
+    }
+    size -= removed;
+    return removed;
+}
+
+// Находит узел по индексу (index < size), начиная с ближайшей из трех точек:
+// головы, хвоста или пальца. Состояние списка не меняется.
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::Node* DoubleList<T, Alloc>::walk(size_t index) const {
+    Node* current;
+    size_t position;
+    size_t best = index;             // расстояние от головы
+    if (size - 1 - index < best) {   // от хвоста
+        best = size - 1 - index;
         current = tail;
-        for (size_t i = 0; i < size - 1 - index; ++i) {
-            current = current->prev;
+        position = size - 1;
+    } else {
+        current = head;
+        position = 0;
+    }
+    if (finger) {
+        size_t fromFinger = index > fingerIndex ? index - fingerIndex : fingerIndex - index;
+        if (fromFinger < best) {
+            current = finger;
+            position = fingerIndex;
         }
     }
-    return current->data;
+
+    while (position < index) {
+        current = current->next;
+        ++position;
+    }
+    while (position > index) {
+        current = current->prev;
+        --position;
+    }
+    return current;
+}
+
+// То же, что walk(), но найденный узел становится новым пальцем
+template<typename T, typename Alloc>
+typename DoubleList<T, Alloc>::Node* DoubleList<T, Alloc>::locate(size_t index) {
+    finger = walk(index);
+    fingerIndex = index;
+    return finger;
+}
+
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::resetFinger() {
+    finger = nullptr;
+    fingerIndex = 0;
+}
+
+template<typename T, typename Alloc>
+T& DoubleList<T, Alloc>::get(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return locate(index)->data;
+}
+
+template<typename T, typename Alloc>
+const T& DoubleList<T, Alloc>::get(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return walk(index)->data;
 }
 
-template<typename T>
-T& DoubleList<T>::front() {
+template<typename T, typename Alloc>
+T& DoubleList<T, Alloc>::front() {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
     return head->data;
 }
 
-template<typename T>
-const T& DoubleList<T>::front() const {
+template<typename T, typename Alloc>
+const T& DoubleList<T, Alloc>::front() const {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
     return head->data;
 }
 
-template<typename T>
-T& DoubleList<T>::back() {
+template<typename T, typename Alloc>
+T& DoubleList<T, Alloc>::back() {
     if (!tail) {
         throw std::runtime_error("List is empty");
     }
     return tail->data;
 }
 
-template<typename T>
-const T& DoubleList<T>::back() const {
+template<typename T, typename Alloc>
+const T& DoubleList<T, Alloc>::back() const {
     if (!tail) {
         throw std::runtime_error("List is empty");
     }
     return tail->data;
 }
 
-template<typename T>
-size_t DoubleList<T>::getSize() const {
+template<typename T, typename Alloc>
+size_t DoubleList<T, Alloc>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool DoubleList<T>::isEmpty() const {
+template<typename T, typename Alloc>
+bool DoubleList<T, Alloc>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void DoubleList<T>::clear() {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::clear() {
     while (head) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        Alloc::destroy(temp);
     }
     head = tail = nullptr;
     size = 0;
+    resetFinger();
 }
 
-template<typename T>
-bool DoubleList<T>::find(const T& value) const {
+template<typename T, typename Alloc>
+bool DoubleList<T, Alloc>::find(const T& value) const {
     Node* current = head;
     while (current) {
         if (current->data == value) {
@@ -545,8 +1017,8 @@ bool DoubleList<T>::find(const T& value) const {
     return false;
 }
 
-template<typename T>
-void DoubleList<T>::print() const {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::print() const {
     std::cout << "[";
     Node* current = head;
     while (current) {
@@ -557,8 +1029,8 @@ void DoubleList<T>::print() const {
     std::cout << "]" << std::endl;
 }
 
-template<typename T>
-void DoubleList<T>::printReverse() const {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::printReverse() const {
     std::cout << "[";
     Node* current = tail;
     while (current) {
@@ -569,19 +1041,19 @@ void DoubleList<T>::printReverse() const {
     std::cout << "]" << std::endl;
 }
 
-template<typename T>
-void DoubleList<T>::serialize(std::ostream& out) const {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::serialize(std::ostream& out) const {
     serializeBinary(out);
 }
 
-template<typename T>
-void DoubleList<T>::deserialize(std::istream& in) {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::deserialize(std::istream& in) {
     deserializeBinary(in);
 }
 
 // Важно: бинарная сериализация корректна только для тривиально копируемых типов
-template<typename T>
-void DoubleList<T>::serializeBinary(std::ostream& out) const {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::serializeBinary(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&size), sizeof(size));
     Node* current = head;
     while (current) {
@@ -591,8 +1063,8 @@ void DoubleList<T>::serializeBinary(std::ostream& out) const {
 }
 
 // Важно: бинарная десериализация корректна только для тривиально копируемых типов
-template<typename T>
-void DoubleList<T>::deserializeBinary(std::istream& in) {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::deserializeBinary(std::istream& in) {
     clear();
     size_t new_size;
     in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
@@ -603,8 +1075,8 @@ void DoubleList<T>::deserializeBinary(std::istream& in) {
     }
 }
 
-template<typename T>
-void DoubleList<T>::serializeText(std::ostream& out) const {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::serializeText(std::ostream& out) const {
     out << size << std::endl;
     Node* current = head;
     while (current) {
@@ -615,8 +1087,8 @@ void DoubleList<T>::serializeText(std::ostream& out) const {
     out << std::endl;
 }
 
-template<typename T>
-void DoubleList<T>::deserializeText(std::istream& in) {
+template<typename T, typename Alloc>
+void DoubleList<T, Alloc>::deserializeText(std::istream& in) {
     clear();
     size_t new_size;
     in >> new_size;
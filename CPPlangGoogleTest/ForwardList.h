@@ -1,17 +1,24 @@
 #pragma once
 #include <iostream>
 #include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include "NodePool.h"
 
 /**
  * @brief Класс односвязного списка.
  * 
  * Реализует последовательный контейнер с эффективной вставкой/удалением в начале (O(1)).
- * Доступ к произвольным элементам и вставка в конец выполняются за O(N).
+ * Благодаря указателю на хвост вставка в конец также выполняется за O(1).
+ * Доступ к произвольным элементам выполняется за O(N); для последовательного обхода
+ * предназначены однонаправленные итераторы.
  * 
  * @tparam T Тип элементов списка. Должен быть копируемым и конструируемым по умолчанию.
+ * @tparam Alloc Политика выделения узлов: DefaultNodeAllocator (new/delete)
+ *               или PooledNodeAllocator<> (переиспользование узлов через NodePool).
  * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
  */
-template<typename T>
+template<typename T, typename Alloc = DefaultNodeAllocator>
 class ForwardList {
 private:
     struct Node {
@@ -21,9 +28,160 @@ private:
     };
 
     Node* head;  ///< Указатель на начало списка
+    Node* tail;  ///< Указатель на последний элемент списка
     size_t size; ///< Текущее количество элементов
 
+    static Node* splitAfter(Node* start, size_t count);
+    static Node* mergeChains(Node* a, Node* b, Node*& mergedTail);
+
 public:
+    /**
+     * @brief Однонаправленный итератор списка.
+     * @tparam IsConst true для константного итератора.
+     */
+    template<bool IsConst>
+    class IteratorBase {
+    private:
+        Node* node;
+        friend class ForwardList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        explicit IteratorBase(Node* n = nullptr) : node(n) {}
+
+        /// Неявное преобразование iterator -> const_iterator.
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& other) : node(other.node) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+
+        IteratorBase& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase copy = *this;
+            node = node->next;
+            return copy;
+        }
+
+        bool operator==(const IteratorBase& other) const { return node == other.node; }
+        bool operator!=(const IteratorBase& other) const { return node != other.node; }
+
+        template<bool> friend class IteratorBase;
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    /**
+     * @brief Курсор для редактирования списка за один проход.
+     *
+     * Курсор указывает либо на элемент, либо на позицию перед началом списка.
+     * Вставка и удаление выполняются после курсора за O(1), без повторного прохода от головы.
+     * Курсор остается действительным, пока не удален элемент, на который он указывает.
+     */
+    class Cursor {
+    private:
+        ForwardList* list;
+        Node* current; ///< nullptr означает позицию перед началом списка
+
+        friend class ForwardList;
+        explicit Cursor(ForwardList* owner) : list(owner), current(nullptr) {}
+
+        Node* nextNode() const { return current ? current->next : list->head; }
+
+    public:
+        /**
+         * @brief Проверяет, находится ли курсор перед началом списка.
+         * @return true, если курсор еще не указывает ни на один элемент.
+         */
+        bool isBeforeBegin() const { return current == nullptr; }
+
+        /**
+         * @brief Проверяет, есть ли элемент после курсора.
+         * @return true, если advance() допустим.
+         */
+        bool hasNext() const { return nextNode() != nullptr; }
+
+        /**
+         * @brief Возвращает элемент под курсором.
+         * @return T& Ссылка на элемент.
+         * @throw std::runtime_error Если курсор перед началом списка.
+         */
+        T& get() const {
+            if (!current) {
+                throw std::runtime_error("Cursor is before the first element");
+            }
+            return current->data;
+        }
+
+        /**
+         * @brief Возвращает элемент после курсора.
+         * @return T& Ссылка на следующий элемент.
+         * @throw std::out_of_range Если следующего элемента нет.
+         */
+        T& peekNext() const {
+            Node* next = nextNode();
+            if (!next) {
+                throw std::out_of_range("Cursor is at the last element");
+            }
+            return next->data;
+        }
+
+        /**
+         * @brief Перемещает курсор на следующий элемент.
+         * @throw std::out_of_range Если следующего элемента нет.
+         */
+        void advance() {
+            Node* next = nextNode();
+            if (!next) {
+                throw std::out_of_range("Cursor is at the last element");
+            }
+            current = next;
+        }
+
+        /**
+         * @brief Вставляет элемент после курсора (в начало списка, если курсор перед началом).
+         * Курсор не перемещается. Сложность: O(1).
+         * @param element Добавляемое значение.
+         */
+        void insertAfter(const T& element) {
+            if (!current) {
+                list->pushFront(element);
+            } else {
+                list->insertAfter(const_iterator(current), element);
+            }
+        }
+
+        /**
+         * @brief Удаляет элемент после курсора. Сложность: O(1).
+         * @throw std::out_of_range Если следующего элемента нет.
+         */
+        void eraseAfter() {
+            if (!current) {
+                if (!list->head) {
+                    throw std::out_of_range("Cursor is at the last element");
+                }
+                list->popFront();
+            } else {
+                list->eraseAfter(const_iterator(current));
+            }
+        }
+
+        /**
+         * @brief Возвращает курсор в позицию перед началом списка.
+         */
+        void reset() { current = nullptr; }
+    };
+
     /**
      * @brief Конструктор по умолчанию.
      * Создает пустой список.
@@ -64,7 +222,7 @@ public:
 
     /**
      * @brief Добавляет элемент в конец списка.
-     * Сложность: O(N), так как требуется проход до последнего элемента.
+     * Сложность: O(1) за счет указателя на хвост.
      * 
      * @param element Добавляемое значение.
      */
@@ -80,6 +238,88 @@ public:
      */
     void insert(size_t index, const T& element);
 
+    /**
+     * @brief Вставляет элемент сразу после позиции итератора.
+     * Сложность: O(1).
+     * 
+     * @param pos Итератор на существующий элемент.
+     * @param element Добавляемое значение.
+     * @return Итератор на вставленный элемент.
+     * @throw std::out_of_range Если pos == end().
+     */
+    iterator insertAfter(const_iterator pos, const T& element);
+
+    /**
+     * @brief Удаляет элемент, следующий за позицией итератора.
+     * Сложность: O(1).
+     * 
+     * @param pos Итератор на существующий элемент.
+     * @return Итератор на элемент, следующий за удаленным (или end()).
+     * @throw std::out_of_range Если pos == end() или за pos нет элемента.
+     */
+    iterator eraseAfter(const_iterator pos);
+
+    /**
+     * @brief Переносит все элементы other после позиции pos без выделения памяти.
+     * Сложность: O(1).
+     * 
+     * @param pos Итератор на существующий элемент текущего списка.
+     * @param other Список-источник (становится пустым).
+     * @throw std::out_of_range Если pos == end().
+     */
+    void spliceAfter(const_iterator pos, ForwardList& other);
+
+    /**
+     * @brief Переносит элементы other из интервала (first, last) после позиции pos.
+     * Узлы перепривязываются без выделения памяти; подсчет размера занимает O(K),
+     * где K — количество перенесенных элементов.
+     * 
+     * @param pos Итератор на существующий элемент текущего списка.
+     * @param other Список-источник.
+     * @param first Итератор на элемент other, после которого начинается интервал.
+     * @param last Итератор на элемент other (или end()), перед которым интервал заканчивается.
+     * @note other может совпадать с текущим списком; тогда размер не меняется.
+     * @throw std::out_of_range Если pos или first равны end(), а также если при
+     *        переносе внутри одного списка pos лежит в интервале (first, last).
+     */
+    void spliceAfter(const_iterator pos, ForwardList& other, const_iterator first, const_iterator last);
+
+    /**
+     * @brief Переносит все элементы other в конец текущего списка.
+     * Сложность: O(1).
+     * 
+     * @param other Список-источник (становится пустым).
+     */
+    void spliceBack(ForwardList& other);
+
+    /**
+     * @brief Устойчивая сортировка слиянием "снизу вверх" без рекурсии.
+     * Перепривязывает узлы, не выделяя памяти. Сложность: O(N log N), доп. память O(1).
+     * Требует operator< для T.
+     */
+    void sort();
+
+    /**
+     * @brief Сливает отсортированный список other в текущий отсортированный список.
+     * Устойчиво: при равенстве элементы текущего списка идут первыми.
+     * Сложность: O(N + M), без выделения памяти.
+     * 
+     * @param other Список-источник (становится пустым).
+     */
+    void merge(ForwardList& other);
+
+    /**
+     * @brief Удаляет подряд идущие повторяющиеся элементы, оставляя первый из каждой группы.
+     * @return Количество удаленных элементов.
+     */
+    size_t unique();
+
+    /**
+     * @brief Создает курсор в позиции перед началом списка.
+     * @return Cursor Курсор для обхода и редактирования.
+     */
+    Cursor cursor() { return Cursor(this); }
+
     /**
      * @brief Удаляет первый элемент списка.
      * Сложность: O(1).
@@ -105,6 +345,30 @@ public:
      */
     void removeValue(const T& value);
 
+    /**
+     * @brief Удаляет все элементы, удовлетворяющие предикату, за один проход.
+     * Отцепленные узлы освобождаются одним пакетом через Alloc::destroyChain.
+     * Если предикат выбрасывает исключение, уже отцепленные узлы освобождаются,
+     * а список остается корректным.
+     * 
+     * @param pred Унарный предикат bool(const T&).
+     * @return Количество удаленных элементов.
+     */
+    template<typename Predicate>
+    size_t removeIf(Predicate pred);
+
+    /**
+     * @brief Разделяет список по предикату без выделения памяти.
+     * Элементы, удовлетворяющие pred, остаются в текущем списке, остальные
+     * переносятся в конец rejected. Относительный порядок сохраняется.
+     * 
+     * @param pred Унарный предикат bool(const T&).
+     * @param rejected Список-приемник для элементов, не удовлетворяющих pred.
+     * @return Количество перенесенных элементов.
+     */
+    template<typename Predicate>
+    size_t partition(Predicate pred, ForwardList& rejected);
+
     /**
      * @brief Возвращает ссылку на элемент по индексу.
      * Линейный поиск от головы списка.
@@ -138,6 +402,38 @@ public:
      */
     const T& front() const;
 
+    /**
+     * @brief Возвращает последний элемент.
+     * Сложность: O(1).
+     * @return T& Ссылка на последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    /**
+     * @brief Возвращает последний элемент (const).
+     * @return const T& Константная ссылка на последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    const T& back() const;
+
+    /**
+     * @brief Итератор на первый элемент.
+     * @return iterator Начало списка.
+     */
+    iterator begin() { return iterator(head); }
+
+    /**
+     * @brief Итератор за последним элементом.
+     * @return iterator Конец списка.
+     */
+    iterator end() { return iterator(nullptr); }
+
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return const_iterator(head); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
     /**
      * @brief Возвращает текущее количество элементов.
      * @return size_t Размер списка.
@@ -219,68 +515,70 @@ public:
     void deserializeText(std::istream& in);
 };
 
-template<typename T>
-ForwardList<T>::ForwardList() : head(nullptr), size(0) {}
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList() : head(nullptr), tail(nullptr), size(0) {}
 
-template<typename T>
-ForwardList<T>::ForwardList(const ForwardList& other) : head(nullptr), size(0) {
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::ForwardList(const ForwardList& other) : head(nullptr), tail(nullptr), size(0) {
     if (!other.head) return;
 
     // Оптимизированное копирование O(N) без pushBack
-    head = new Node(other.head->data);
+    head = Alloc::template create<Node>(other.head->data);
     Node* current = head;
     Node* otherCurrent = other.head->next;
     
     while (otherCurrent) {
-        current->next = new Node(otherCurrent->data);
+        current->next = Alloc::template create<Node>(otherCurrent->data);
         current = current->next;
         otherCurrent = otherCurrent->next;
     }
+    tail = current;
     size = other.size;
 }
 
-template<typename T>
-ForwardList<T>& ForwardList<T>::operator=(const ForwardList& other) {
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>& ForwardList<T, Alloc>::operator=(const ForwardList& other) {
     if (this != &other) {
         // Идиома copy-and-swap
         ForwardList temp(other);
         
         Node* tHead = head; head = temp.head; temp.head = tHead;
+        Node* tTail = tail; tail = temp.tail; temp.tail = tTail;
         size_t tSize = size; size = temp.size; temp.size = tSize;
     }
     return *this;
 }
 
-template<typename T>
-ForwardList<T>::~ForwardList() {
+template<typename T, typename Alloc>
+ForwardList<T, Alloc>::~ForwardList() {
     clear();
 }
 
-template<typename T>
-void ForwardList<T>::pushFront(const T& element) {
-    Node* newNode = new Node(element);
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::pushFront(const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
     newNode->next = head;
     head = newNode;
+    if (!tail) {
+        tail = newNode;
+    }
     ++size;
 }
 
-template<typename T>
-void ForwardList<T>::pushBack(const T& element) {
-    Node* newNode = new Node(element);
-    if (!head) {
-        head = newNode;
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::pushBack(const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
+    if (!tail) {
+        head = tail = newNode;
     } else {
-        Node* current = head;
-        while (current->next) {
-            current = current->next;
-        }
-        current->next = newNode;
+        tail->next = newNode;
+        tail = newNode;
     }
     ++size;
 }
 
-template<typename T>
-void ForwardList<T>::insert(size_t index, const T& element) {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::insert(size_t index, const T& element) {
     if (index > size) {
         throw std::out_of_range("Index out of range");
     }
@@ -288,8 +586,12 @@ void ForwardList<T>::insert(size_t index, const T& element) {
         pushFront(element);
         return;
     }
+    if (index == size) {
+        pushBack(element);
+        return;
+    }
 
-    Node* newNode = new Node(element);
+    Node* newNode = Alloc::template create<Node>(element);
     Node* current = head;
     for (size_t i = 0; i < index - 1; ++i) {
         current = current->next;
@@ -299,19 +601,22 @@ void ForwardList<T>::insert(size_t index, const T& element) {
     ++size;
 }
 
-template<typename T>
-void ForwardList<T>::popFront() {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::popFront() {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
     Node* temp = head;
     head = head->next;
-    delete temp;
+    if (!head) {
+        tail = nullptr;
+    }
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-void ForwardList<T>::remove(size_t index) {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::remove(size_t index) {
     if (index >= size) {
         throw std::out_of_range("Index out of range");
     }
@@ -326,33 +631,85 @@ void ForwardList<T>::remove(size_t index) {
     }
     Node* temp = current->next;
     current->next = temp->next;
-    delete temp;
+    if (temp == tail) {
+        tail = current;
+    }
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-void ForwardList<T>::removeValue(const T& value) {
-    while (head && head->data == value) {
-        popFront();
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::removeValue(const T& value) {
+    removeIf([&value](const T& element) { return element == value; });
+}
+
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t ForwardList<T, Alloc>::removeIf(Predicate pred) {
+    Node* removedHead = nullptr; // отцепленные узлы, освобождаемые пакетом
+    Node* removedTail = nullptr;
+    size_t removed = 0;
+    Node* prev = nullptr;
+    Node* current = head;
+    try {
+        while (current) {
+            Node* next = current->next;
+            if (pred(current->data)) {
+                if (prev) prev->next = next;
+                else head = next;
+                current->next = nullptr;
+                if (removedTail) removedTail->next = current;
+                else removedHead = current;
+                removedTail = current;
+                ++removed;
+            } else {
+                prev = current;
+            }
+            current = next;
+        }
+    } catch (...) {
+        // Хвост еще не пройден, поэтому остается на месте
+        size -= removed;
+        Alloc::destroyChain(removedHead);
+        throw;
     }
+    tail = prev;
+    size -= removed;
+    Alloc::destroyChain(removedHead);
+    return removed;
+}
 
-    if (!head) return;
+template<typename T, typename Alloc>
+template<typename Predicate>
+size_t ForwardList<T, Alloc>::partition(Predicate pred, ForwardList& rejected) {
+    if (&rejected == this) return 0;
 
+    size_t moved = 0;
+    Node* prev = nullptr;
     Node* current = head;
-    while (current->next) {
-        if (current->next->data == value) {
-            Node* temp = current->next;
-            current->next = temp->next;
-            delete temp;
-            --size;
+    while (current) {
+        Node* next = current->next;
+        if (pred(current->data)) {
+            prev = current;
         } else {
-            current = current->next;
+            if (prev) prev->next = next;
+            else head = next;
+            current->next = nullptr;
+            if (rejected.tail) rejected.tail->next = current;
+            else rejected.head = current;
+            rejected.tail = current;
+            ++rejected.size;
+            --size;
+            ++moved;
         }
+        current = next;
     }
+    tail = prev;
+    return moved;
 }
 
-template<typename T>
-T& ForwardList<T>::get(size_t index) {
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::get(size_t index) {
     if (index >= size) {
         throw std::out_of_range("Index out of range");
     }
@@ -363,8 +720,8 @@ T& ForwardList<T>::get(size_t index) {
     return current->data;
 }
 
-template<typename T>
-const T& ForwardList<T>::get(size_t index) const {
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::get(size_t index) const {
     if (index >= size) {
         throw std::out_of_range("Index out of range");
     }
@@ -375,45 +732,264 @@ const T& ForwardList<T>::get(size_t index) const {
     return current->data;
 }
 
-template<typename T>
-T& ForwardList<T>::front() {
+template<typename T, typename Alloc>
+typename ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::insertAfter(const_iterator pos, const T& element) {
+    if (!pos.node) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    Node* newNode = Alloc::template create<Node>(element);
+    newNode->next = pos.node->next;
+    pos.node->next = newNode;
+    if (pos.node == tail) {
+        tail = newNode;
+    }
+    ++size;
+    return iterator(newNode);
+}
+
+template<typename T, typename Alloc>
+typename ForwardList<T, Alloc>::iterator ForwardList<T, Alloc>::eraseAfter(const_iterator pos) {
+    if (!pos.node || !pos.node->next) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    Node* temp = pos.node->next;
+    pos.node->next = temp->next;
+    if (temp == tail) {
+        tail = pos.node;
+    }
+    Alloc::destroy(temp);
+    --size;
+    return iterator(pos.node->next);
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::spliceAfter(const_iterator pos, ForwardList& other) {
+    if (!pos.node) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    if (&other == this || !other.head) return;
+
+    other.tail->next = pos.node->next;
+    pos.node->next = other.head;
+    if (pos.node == tail) {
+        tail = other.tail;
+    }
+    size += other.size;
+    other.head = other.tail = nullptr;
+    other.size = 0;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::spliceAfter(const_iterator pos, ForwardList& other,
+                                        const_iterator first, const_iterator last) {
+    if (!pos.node || !first.node) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    Node* rangeHead = first.node->next;
+    if (rangeHead == last.node) return;
+
+    // Находим последний узел интервала и считаем перенесенные элементы.
+    // При переносе внутри списка pos не должен попасть в интервал, иначе получится цикл.
+    bool self = &other == this;
+    Node* rangeTail = rangeHead;
+    size_t count = 1;
+    while (true) {
+        if (self && rangeTail == pos.node) {
+            throw std::out_of_range("Splice position lies inside the moved range");
+        }
+        if (rangeTail->next == last.node) break;
+        rangeTail = rangeTail->next;
+        ++count;
+    }
+
+    // Для self хвост сначала обновляется как после вырезания, затем как после вставки
+    first.node->next = last.node;
+    if (rangeTail == other.tail) {
+        other.tail = first.node;
+    }
+    rangeTail->next = pos.node->next;
+    pos.node->next = rangeHead;
+    if (pos.node == tail) {
+        tail = rangeTail;
+    }
+    if (!self) {
+        other.size -= count;
+        size += count;
+    }
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::spliceBack(ForwardList& other) {
+    if (&other == this || !other.head) return;
+
+    if (!tail) {
+        head = other.head;
+    } else {
+        tail->next = other.head;
+    }
+    tail = other.tail;
+    size += other.size;
+    other.head = other.tail = nullptr;
+    other.size = 0;
+}
+
+// Отрезает цепочку после count узлов, начиная со start; возвращает остаток
+template<typename T, typename Alloc>
+typename ForwardList<T, Alloc>::Node* ForwardList<T, Alloc>::splitAfter(Node* start, size_t count) {
+    for (size_t i = 1; start && i < count; ++i) {
+        start = start->next;
+    }
+    if (!start) return nullptr;
+    Node* rest = start->next;
+    start->next = nullptr;
+    return rest;
+}
+
+// Сливает две отсортированные цепочки; при равенстве первым идет элемент из a
+template<typename T, typename Alloc>
+typename ForwardList<T, Alloc>::Node* ForwardList<T, Alloc>::mergeChains(Node* a, Node* b, Node*& mergedTail) {
+    Node* result = nullptr;
+    Node* last = nullptr;
+    while (a && b) {
+        Node* taken;
+        if (b->data < a->data) {
+            taken = b;
+            b = b->next;
+        } else {
+            taken = a;
+            a = a->next;
+        }
+        if (last) last->next = taken;
+        else result = taken;
+        last = taken;
+    }
+
+    Node* remainder = a ? a : b;
+    if (last) last->next = remainder;
+    else result = remainder;
+    if (remainder) {
+        last = remainder;
+        while (last->next) {
+            last = last->next;
+        }
+    }
+    mergedTail = last;
+    return result;
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::sort() {
+    if (size < 2) return;
+
+    for (size_t width = 1; width < size; width *= 2) {
+        Node* rest = head;
+        Node* newHead = nullptr;
+        Node* newTail = nullptr;
+        while (rest) {
+            Node* left = rest;
+            Node* right = splitAfter(left, width);
+            rest = splitAfter(right, width);
+
+            Node* mergedTail;
+            Node* merged = mergeChains(left, right, mergedTail);
+            if (newTail) {
+                newTail->next = merged;
+            } else {
+                newHead = merged;
+            }
+            newTail = mergedTail;
+        }
+        head = newHead;
+        tail = newTail;
+    }
+}
+
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::merge(ForwardList& other) {
+    if (&other == this || !other.head) return;
+
+    Node* mergedTail;
+    head = mergeChains(head, other.head, mergedTail);
+    tail = mergedTail;
+    size += other.size;
+    other.head = other.tail = nullptr;
+    other.size = 0;
+}
+
+template<typename T, typename Alloc>
+size_t ForwardList<T, Alloc>::unique() {
+    size_t removed = 0;
+    Node* current = head;
+    while (current && current->next) {
+        if (current->next->data == current->data) {
+            Node* temp = current->next;
+            current->next = temp->next;
+            Alloc::destroy(temp);
+            ++removed;
+        } else {
+            current = current->next;
+        }
+    }
+    tail = current;
+    size -= removed;
+    return removed;
+}
+
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::front() {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
     return head->data;
 }
 
-template<typename T>
-const T& ForwardList<T>::front() const {
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::front() const {
     if (!head) {
         throw std::runtime_error("List is empty");
     }
     return head->data;
 }
 
-template<typename T>
-size_t ForwardList<T>::getSize() const {
+template<typename T, typename Alloc>
+T& ForwardList<T, Alloc>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail->data;
+}
+
+template<typename T, typename Alloc>
+const T& ForwardList<T, Alloc>::back() const {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail->data;
+}
+
+template<typename T, typename Alloc>
+size_t ForwardList<T, Alloc>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool ForwardList<T>::isEmpty() const {
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void ForwardList<T>::clear() {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::clear() {
     while (head) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        Alloc::destroy(temp);
     }
-    head = nullptr;
+    head = tail = nullptr;
     size = 0;
 }
 
-template<typename T>
-bool ForwardList<T>::find(const T& value) const {
+template<typename T, typename Alloc>
+bool ForwardList<T, Alloc>::find(const T& value) const {
     Node* current = head;
     while (current) {
         if (current->data == value) {
@@ -424,8 +1000,8 @@ bool ForwardList<T>::find(const T& value) const {
     return false;
 }
 
-template<typename T>
-void ForwardList<T>::print() const {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::print() const {
     std::cout << "[";
     Node* current = head;
     while (current) {
@@ -436,19 +1012,19 @@ void ForwardList<T>::print() const {
     std::cout << "]" << std::endl;
 }
 
-template<typename T>
-void ForwardList<T>::serialize(std::ostream& out) const {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::serialize(std::ostream& out) const {
     serializeBinary(out);
 }
 
-template<typename T>
-void ForwardList<T>::deserialize(std::istream& in) {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::deserialize(std::istream& in) {
     deserializeBinary(in);
 }
 
 // Важно: бинарная сериализация корректна только для тривиально копируемых типов
-template<typename T>
-void ForwardList<T>::serializeBinary(std::ostream& out) const {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::serializeBinary(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&size), sizeof(size));
     Node* current = head;
     while (current) {
@@ -458,31 +1034,21 @@ void ForwardList<T>::serializeBinary(std::ostream& out) const {
 }
 
 // Важно: бинарная десериализация корректна только для тривиально копируемых типов
-template<typename T>
-void ForwardList<T>::deserializeBinary(std::istream& in) {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::deserializeBinary(std::istream& in) {
     clear();
     size_t new_size;
     in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
-    if (new_size == 0) return;
-
-    // Читаем первый элемент
-    T value;
-    in.read(reinterpret_cast<char*>(&value), sizeof(T));
-    head = new Node(value);
-    size = 1;
-
-    // Читаем остальные, поддерживая указатель на хвост
-    Node* current = head;
-    for (size_t i = 1; i < new_size; ++i) {
+    // pushBack работает за O(1), поэтому восстановление выполняется за O(N)
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
         in.read(reinterpret_cast<char*>(&value), sizeof(T));
-        current->next = new Node(value);
-        current = current->next;
-        size++;
+        pushBack(value);
     }
 }
 
-template<typename T>
-void ForwardList<T>::serializeText(std::ostream& out) const {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::serializeText(std::ostream& out) const {
     out << size << std::endl;
     Node* current = head;
     while (current) {
@@ -493,25 +1059,14 @@ void ForwardList<T>::serializeText(std::ostream& out) const {
     out << std::endl;
 }
 
-template<typename T>
-void ForwardList<T>::deserializeText(std::istream& in) {
+template<typename T, typename Alloc>
+void ForwardList<T, Alloc>::deserializeText(std::istream& in) {
     clear();
     size_t new_size;
     in >> new_size;
-    if (new_size == 0) return;
-
-    // Читаем первый элемент
-    T value;
-    in >> value;
-    head = new Node(value);
-    size = 1;
-
-    // Читаем остальные
-    Node* current = head;
-    for (size_t i = 1; i < new_size; ++i) {
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
         in >> value;
-        current->next = new Node(value);
-        current = current->next;
-        size++;
+        pushBack(value);
     }
 }
\ No newline at end of file
@@ -1,9 +1,17 @@
 #pragma once
 #include <iostream>
 #include <stdexcept>
-#include <queue>
 #include <sstream>
 #include <string> // Явно включено для поддержки std::string
+#include <vector>
+#include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <iterator>
+#include "HashTable.h"
+#include "NodeArena.h"
 
 /**
  * @brief Шаблонный класс полного бинарного дерева (Full Binary Tree).
@@ -12,9 +20,23 @@
  * Вставка новых элементов происходит таким образом, чтобы дерево заполнялось равномерно,
  * поддерживая свойство полноты.
  *
+ * Дерево поддерживает "фронт вставки": массив levelOrder хранит узлы в порядке обхода
+ * в ширину, причем внутренние узлы всегда образуют его префикс. Поэтому потомки i-го узла
+ * находятся в levelOrder по индексам 2i+1 и 2i+2, следующий расширяемый лист — узел
+ * levelOrder[(size-1)/2], а последняя пара листьев — два последних элемента массива.
+ *
+ * При Indexed = true дерево дополнительно ведет хеш-индекс "значение -> позиции в levelOrder",
+ * и find/remove находят узел за O(1) в среднем вместо обхода. Индекс стоит дополнительной
+ * памяти и обновления при каждой вставке и удалении.
+ *
+ * Узлы выделяются из собственной арены дерева (NodeArena): потомки, созданные одной
+ * вставкой, лежат в памяти рядом, а clear() и деструктор возвращают память блоками.
+ * Для тривиально разрушаемого T узлы при этом вообще не обходятся.
+ *
  * @tparam T Тип хранимых данных.
+ * @tparam Indexed Вести ли хеш-индекс значений (требует std::hash<T>).
  */
-template<typename T>
+template<typename T, bool Indexed = false>
 class FullBinaryTree {
 private:
     struct Node {
@@ -26,17 +48,139 @@ private:
 
     Node* root;
     size_t size;
+    std::vector<Node*> levelOrder; ///< Узлы в порядке обхода в ширину (фронт вставки)
+    NodeArena<Node> arena;         ///< Память всех узлов дерева
+
+    struct NoIndex {};
+    using ValueIndex = typename std::conditional<Indexed, HashTable<T, std::vector<size_t>>, NoIndex>::type;
+    ValueIndex valueIndex; ///< Значение -> позиции узлов в levelOrder (только при Indexed)
+
+    void indexAdd(const T& value, size_t position);
+    void indexErase(const T& value, size_t position);
+    bool locate(const T& value, size_t& position) const;
+
+    static constexpr size_t MIN_PARALLEL_RANGE = 16384; ///< Минимум узлов на одну задачу
+    size_t taskCount(unsigned threads) const;
+    template<typename RangeFunc>
+    void forEachRange(size_t tasks, RangeFunc rangeFunc) const;
 
     void destroyTree(Node* node);
-    Node* copyTree(Node* node);
-    bool isFullBinaryTreeHelper(Node* node) const;
-    void printInOrderHelper(Node* node) const;
+    bool rebuildLevelOrder();
+    void rebuildIndex();
+    void restoreFrontier();
+    Node* copyTree(const std::vector<Node*>& source, std::vector<Node*>& copy);
     void serializeHelper(Node* node, std::ostream& out) const;
     Node* deserializeHelper(std::istream& in);
     void serializeBinaryHelper(Node* node, std::ostream& out) const;
     Node* deserializeBinaryHelper(std::istream& in);
 
 public:
+    /**
+     * @brief Порядок обхода для TraversalIterator.
+     */
+    enum class TraversalOrder { LevelOrder, PreOrder, InOrder, PostOrder };
+
+    /**
+     * @brief Итератор обхода дерева без стека и без выделения памяти.
+     *
+     * Хранит только индекс узла в levelOrder: так как потомки узла i находятся
+     * по индексам 2i+1 и 2i+2, переход к следующему узлу в любом порядке обхода
+     * вычисляется по индексам (O(1) амортизированно, O(log N) в худшем случае).
+     * Значения доступны только для чтения. Изменение дерева делает итератор недействительным.
+     *
+     * @tparam Order Порядок обхода.
+     */
+    template<TraversalOrder Order>
+    class TraversalIterator {
+    private:
+        const std::vector<Node*>* nodes;
+        size_t index; ///< Индекс текущего узла; nodes->size() означает конец
+
+        size_t count() const { return nodes->size(); }
+        bool hasChildren(size_t i) const { return 2 * i + 1 < count(); }
+        size_t leftmost(size_t i) const {
+            while (hasChildren(i)) i = 2 * i + 1;
+            return i;
+        }
+
+        void advance() {
+            size_t n = count();
+            switch (Order) {
+            case TraversalOrder::LevelOrder:
+                ++index;
+                break;
+            case TraversalOrder::PreOrder:
+                if (hasChildren(index)) {
+                    index = 2 * index + 1;
+                    break;
+                }
+                // Поднимаемся, пока узел — правый потомок; затем переходим к правому брату
+                while (index != 0 && index % 2 == 0) index = (index - 1) / 2;
+                index = index == 0 ? n : index + 1;
+                break;
+            case TraversalOrder::InOrder:
+                if (hasChildren(index)) {
+                    index = leftmost(2 * index + 2);
+                    break;
+                }
+                while (index != 0 && index % 2 == 0) index = (index - 1) / 2;
+                index = index == 0 ? n : (index - 1) / 2;
+                break;
+            case TraversalOrder::PostOrder:
+                if (index == 0) {
+                    index = n;
+                } else if (index % 2 == 1) {
+                    index = leftmost(index + 1); // левый потомок: дальше поддерево брата
+                } else {
+                    index = (index - 1) / 2;     // правый потомок: дальше родитель
+                }
+                break;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        TraversalIterator() : nodes(nullptr), index(0) {}
+        TraversalIterator(const std::vector<Node*>* levelNodes, bool atEnd) : nodes(levelNodes), index(0) {
+            if (atEnd || count() == 0) {
+                index = count();
+            } else if (Order == TraversalOrder::InOrder || Order == TraversalOrder::PostOrder) {
+                index = leftmost(0);
+            }
+        }
+
+        reference operator*() const { return (*nodes)[index]->data; }
+        pointer operator->() const { return &(*nodes)[index]->data; }
+
+        TraversalIterator& operator++() { advance(); return *this; }
+        TraversalIterator operator++(int) { TraversalIterator copy = *this; advance(); return copy; }
+
+        bool operator==(const TraversalIterator& other) const { return index == other.index; }
+        bool operator!=(const TraversalIterator& other) const { return index != other.index; }
+    };
+
+    /**
+     * @brief Пара итераторов для range-based for.
+     * @tparam Order Порядок обхода.
+     */
+    template<TraversalOrder Order>
+    class TraversalRange {
+    private:
+        const std::vector<Node*>* nodes;
+
+    public:
+        explicit TraversalRange(const std::vector<Node*>* levelNodes) : nodes(levelNodes) {}
+        TraversalIterator<Order> begin() const { return TraversalIterator<Order>(nodes, false); }
+        TraversalIterator<Order> end() const { return TraversalIterator<Order>(nodes, true); }
+    };
+
+    using const_iterator = TraversalIterator<TraversalOrder::LevelOrder>;
+
     /**
      * @brief Конструктор по умолчанию. Создает пустое дерево.
      */
@@ -67,28 +211,65 @@ public:
 
     /**
      * @brief Вставляет значение в дерево.
-     * Алгоритм ищет первый свободный лист (в порядке обхода в ширину) и добавляет
-     * к нему два дочерних узла с переданным значением, сохраняя инвариант полноты дерева.
+     * Добавляет два дочерних узла с переданным значением к первому листу в порядке
+     * обхода в ширину, сохраняя инвариант полноты дерева. Лист берется из фронта
+     * вставки, поэтому сложность O(1) амортизированно.
      * @param value Значение для вставки.
      */
     void insert(const T& value);
 
     /**
-     * @brief Удаляет значение из дерева.
-     * Если удаляемый узел — лист, удаляется также его "брат".
-     * Если узел внутренний, его значение замещается значением самого правого листа,
-     * после чего удаляется этот лист и его брат.
+     * @brief Удаляет значение из дерева (первое вхождение в порядке обхода в ширину).
+     * Если узел входит в последнюю пару листьев, удаляется эта пара.
+     * Иначе его значение замещается значением самого правого листа,
+     * после чего удаляется этот лист и его брат. Так дерево сохраняет форму,
+     * при которой фронт вставки остается корректным.
+     * Поиск узла — O(1) в среднем при Indexed, иначе O(N); само удаление — O(1).
      * @param value Значение для удаления.
      */
     void remove(const T& value);
 
     /**
      * @brief Ищет значение в дереве.
+     * Сложность: O(1) в среднем при Indexed, иначе O(N).
      * @param value Искомое значение.
      * @return true, если значение найдено, иначе false.
      */
     bool find(const T& value) const;
 
+    /**
+     * @brief Параллельный поиск значения.
+     * Массив levelOrder делится на равные диапазоны, каждый проверяется отдельной задачей
+     * (std::async); задачи прекращают работу, как только значение найдено в любой из них.
+     * Изменять дерево во время вызова нельзя.
+     * @param value Искомое значение.
+     * @param threads Число задач; 0 — std::thread::hardware_concurrency().
+     * @return true, если значение найдено.
+     */
+    bool parallelFind(const T& value, unsigned threads = 0) const;
+
+    /**
+     * @brief Параллельно применяет функцию ко всем значениям (порядок не определен).
+     * Исключение из func пробрасывается вызывающему после завершения всех задач.
+     * @param func Функция вида void(const T&); должна быть потокобезопасной.
+     * @param threads Число задач; 0 — std::thread::hardware_concurrency().
+     */
+    template<typename Func>
+    void parallelForEach(Func func, unsigned threads = 0) const;
+
+    /**
+     * @brief Параллельная свертка значений.
+     * Каждая задача сворачивает свой диапазон: acc = combine(acc, map(value)),
+     * затем частичные результаты объединяются тем же combine.
+     * @param identity Нейтральный элемент для combine.
+     * @param map Преобразование R(const T&).
+     * @param combine Ассоциативная операция R(R, R).
+     * @param threads Число задач; 0 — std::thread::hardware_concurrency().
+     * @return Результат свертки (identity для пустого дерева).
+     */
+    template<typename R, typename Map, typename Combine>
+    R parallelReduce(R identity, Map map, Combine combine, unsigned threads = 0) const;
+
     /**
      * @brief Проверяет корректность структуры полного бинарного дерева.
      * @return true, если у каждого узла либо 0, либо 2 потомка.
@@ -123,6 +304,44 @@ public:
      */
     void printInOrder() const;
 
+    /**
+     * @brief Итераторы обхода в ширину (для range-based for).
+     */
+    const_iterator begin() const { return const_iterator(&levelOrder, false); }
+    const_iterator end() const { return const_iterator(&levelOrder, true); }
+
+    /**
+     * @brief Обход в ширину.
+     * @return Диапазон для range-based for.
+     */
+    TraversalRange<TraversalOrder::LevelOrder> levelOrderRange() const {
+        return TraversalRange<TraversalOrder::LevelOrder>(&levelOrder);
+    }
+
+    /**
+     * @brief Прямой обход (корень, левое, правое поддерево).
+     * @return Диапазон для range-based for.
+     */
+    TraversalRange<TraversalOrder::PreOrder> preOrderRange() const {
+        return TraversalRange<TraversalOrder::PreOrder>(&levelOrder);
+    }
+
+    /**
+     * @brief Симметричный обход (левое поддерево, корень, правое поддерево).
+     * @return Диапазон для range-based for.
+     */
+    TraversalRange<TraversalOrder::InOrder> inOrderRange() const {
+        return TraversalRange<TraversalOrder::InOrder>(&levelOrder);
+    }
+
+    /**
+     * @brief Обратный обход (левое, правое поддерево, корень).
+     * @return Диапазон для range-based for.
+     */
+    TraversalRange<TraversalOrder::PostOrder> postOrderRange() const {
+        return TraversalRange<TraversalOrder::PostOrder>(&levelOrder);
+    }
+
     /**
      * @brief Универсальная сериализация.
      * По умолчанию делегирует вызов бинарной сериализации.
@@ -151,6 +370,7 @@ public:
      * Восстанавливает дерево из бинарного формата.
      * @note Ожидает данные тривиально копируемых типов (POD).
      * @param in Поток ввода.
+     * @throw std::runtime_error Если внутренние узлы не образуют префикс обхода в ширину.
      */
     void deserializeBinary(std::istream& in);
 
@@ -165,372 +385,669 @@ public:
      * @brief Текстовая десериализация.
      * Восстанавливает дерево из текстового представления.
      * @param in Поток ввода.
+     * @throw std::runtime_error Если внутренние узлы не образуют префикс обхода в ширину.
      */
     void deserializeText(std::istream& in);
+
+    /**
+     * @brief Компактная сериализация: форма битами и значения одним массивом.
+     * Формат: <size_t N><битовый вектор формы, (N+7)/8 байт><N значений T подряд>.
+     * Бит i равен 1, если i-й узел в порядке обхода в ширину внутренний (у него 2 потомка).
+     * Маркеры null не пишутся, значения копируются одним блоком.
+     * @note Предназначена для тривиально копируемых типов (POD).
+     * @param out Поток вывода.
+     */
+    void serializeSuccinct(std::ostream& out) const;
+
+    /**
+     * @brief Десериализация компактного формата (см. serializeSuccinct()).
+     * Узлы создаются в порядке обхода в ширину, потомки связываются по битам формы.
+     * @note Ожидает данные тривиально копируемых типов (POD).
+     * @param in Поток ввода.
+     * @throw std::runtime_error Если поток оборван или биты не задают полное дерево,
+     *        заполненное по уровням.
+     */
+    void deserializeSuccinct(std::istream& in);
 };
 
-template<typename T>
-FullBinaryTree<T>::FullBinaryTree() : root(nullptr), size(0) {}
+template<typename T, bool Indexed>
+FullBinaryTree<T, Indexed>::FullBinaryTree() : root(nullptr), size(0) {}
 
-template<typename T>
-FullBinaryTree<T>::FullBinaryTree(const FullBinaryTree& other) : root(nullptr), size(other.size) {
-    root = copyTree(other.root);
+template<typename T, bool Indexed>
+FullBinaryTree<T, Indexed>::FullBinaryTree(const FullBinaryTree& other) : root(nullptr), size(other.size) {
+    root = copyTree(other.levelOrder, levelOrder);
+    rebuildIndex();
 }
 
-template<typename T>
-FullBinaryTree<T>& FullBinaryTree<T>::operator=(const FullBinaryTree& other) {
+template<typename T, bool Indexed>
+FullBinaryTree<T, Indexed>& FullBinaryTree<T, Indexed>::operator=(const FullBinaryTree& other) {
     if (this != &other) {
-        // Сначала пытаемся создать копию нового дерева.
+        // Сначала пытаемся создать копию нового дерева (в ее собственной арене).
         // Если здесь произойдет исключение (например, нехватка памяти),
         // текущий объект (this) останется в валидном состоянии.
-        Node* newRoot = copyTree(other.root);
-        
-        // Если копирование прошло успешно, освобождаем старую память
-        clear();
+        FullBinaryTree copy(other);
         
-        // Применяем новые данные
-        root = newRoot;
-        size = other.size;
+        // Забираем узлы, арену и индекс копии; старые узлы освободит деструктор copy.
+        // Все обмены не выбрасывают исключений.
+        std::swap(root, copy.root);
+        std::swap(size, copy.size);
+        levelOrder.swap(copy.levelOrder);
+        arena.swap(copy.arena);
+        if constexpr (Indexed) {
+            valueIndex.swap(copy.valueIndex);
+        }
     }
     return *this;
 }
 
-template<typename T>
-FullBinaryTree<T>::~FullBinaryTree() {
+template<typename T, bool Indexed>
+FullBinaryTree<T, Indexed>::~FullBinaryTree() {
     clear();
 }
 
-template<typename T>
-void FullBinaryTree<T>::destroyTree(Node* node) {
-    if (node) {
-        destroyTree(node->left);
-        destroyTree(node->right);
-        delete node;
+// Разрушает узлы поддерева без рекурсии и без дополнительной памяти: левый потомок
+// поворотом поднимается на место текущего узла, пока слева не станет пусто,
+// после чего узел возвращается в арену и обход продолжается с правого поддерева.
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::destroyTree(Node* node) {
+    while (node) {
+        if (node->left) {
+            Node* left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            Node* right = node->right;
+            arena.destroy(node);
+            node = right;
+        }
     }
 }
 
-template<typename T>
-typename FullBinaryTree<T>::Node* FullBinaryTree<T>::copyTree(Node* node) {
-    if (!node) return nullptr;
-
-    Node* newNode = new Node(node->data);
-    newNode->left = copyTree(node->left);
-    newNode->right = copyTree(node->right);
-    return newNode;
+// Копирует дерево по массиву levelOrder: узлы создаются в порядке обхода в ширину,
+// а потомки i-го узла связываются по индексам 2i+1 и 2i+2. Рекурсии нет.
+template<typename T, bool Indexed>
+typename FullBinaryTree<T, Indexed>::Node* FullBinaryTree<T, Indexed>::copyTree(
+        const std::vector<Node*>& source, std::vector<Node*>& copy) {
+    copy.clear();
+    copy.reserve(source.size());
+    try {
+        for (Node* node : source) {
+            copy.push_back(arena.create(node->data));
+        }
+    } catch (...) {
+        for (Node* node : copy) {
+            arena.destroy(node);
+        }
+        copy.clear();
+        throw;
+    }
+    for (size_t i = 0; 2 * i + 2 < copy.size(); ++i) {
+        copy[i]->left = copy[2 * i + 1];
+        copy[i]->right = copy[2 * i + 2];
+    }
+    return copy.empty() ? nullptr : copy[0];
 }
 
-template<typename T>
-void FullBinaryTree<T>::insert(const T& value) {
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::rebuildLevelOrder() {
+    levelOrder.clear();
     if (!root) {
-        // Первая вставка: создаем только корень как лист (0 потомков)
-        root = new Node(value);
-        size = 1;
-        return;
+        rebuildIndex();
+        return true;
     }
 
-    // Находим первый лист (0 потомков), используя обход в ширину
-    std::queue<Node*> q;
-    q.push(root);
-
-    while (!q.empty()) {
-        Node* current = q.front();
-        q.pop();
-
-        // Если узел является листом (нет детей), добавляем двух детей для сохранения полноты дерева
-        if (!current->left && !current->right) {
-            current->left = new Node(value);
-            current->right = new Node(value);
-            size += 2;
-            return;
+    levelOrder.push_back(root);
+    bool seenLeaf = false;
+    for (size_t i = 0; i < levelOrder.size(); ++i) {
+        Node* current = levelOrder[i];
+        if (current->left && current->right) {
+            if (seenLeaf) return false;
+            levelOrder.push_back(current->left);
+            levelOrder.push_back(current->right);
+        } else if (current->left || current->right) {
+            return false;
+        } else {
+            seenLeaf = true;
         }
-
-        // Продолжаем обход только по узлам, у которых есть дети
-        if (current->left) q.push(current->left);
-        if (current->right) q.push(current->right);
     }
+    rebuildIndex();
+    return true;
 }
 
-template<typename T>
-void FullBinaryTree<T>::remove(const T& value) {
-    if (!root) return;
-
-    // Находим узел для удаления и его родителя
-    Node* parent = nullptr;
-    Node* target = nullptr;
-    std::queue<std::pair<Node*, Node*>> q; // пара (узел, родитель)
-    q.push({root, nullptr});
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::rebuildIndex() {
+    if constexpr (Indexed) {
+        valueIndex.clear();
+        for (size_t i = 0; i < levelOrder.size(); ++i) {
+            indexAdd(levelOrder[i]->data, i);
+        }
+    }
+}
 
-    while (!q.empty() && !target) {
-        auto [current, par] = q.front();
-        q.pop();
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::indexAdd(const T& value, size_t position) {
+    if constexpr (Indexed) {
+        valueIndex[value].push_back(position);
+    }
+}
 
-        if (current->data == value) {
-            target = current;
-            parent = par;
-            break;
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::indexErase(const T& value, size_t position) {
+    if constexpr (Indexed) {
+        std::vector<size_t>& positions = valueIndex.get(value);
+        for (size_t i = 0; i < positions.size(); ++i) {
+            if (positions[i] == position) {
+                positions[i] = positions.back();
+                positions.pop_back();
+                break;
+            }
         }
+        if (positions.empty()) {
+            valueIndex.remove(value);
+        }
+    }
+}
 
-        if (current->left) q.push({current->left, current});
-        if (current->right) q.push({current->right, current});
+// Находит первое вхождение значения в порядке обхода в ширину
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::locate(const T& value, size_t& position) const {
+    if constexpr (Indexed) {
+        if (!valueIndex.find(value)) return false;
+        const std::vector<size_t>& positions = valueIndex.get(value);
+        position = positions[0];
+        for (size_t candidate : positions) {
+            if (candidate < position) position = candidate;
+        }
+        return true;
+    } else {
+        for (position = 0; position < size; ++position) {
+            if (levelOrder[position]->data == value) return true;
+        }
+        return false;
     }
+}
 
-    if (!target) return; // Значение не найдено
+// Вызывается после десериализации: фронт вставки требует, чтобы внутренние узлы
+// образовывали префикс обхода в ширину, иначе дерево отвергается.
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::restoreFrontier() {
+    if (!rebuildLevelOrder()) {
+        clear();
+        throw std::runtime_error("Serialized tree is not filled in level order");
+    }
+    size = levelOrder.size();
+}
 
-    // Если удаляемый узел — лист, нужно удалить и его брата для сохранения полноты дерева
-    if (!target->left && !target->right) {
-        if (parent) {
-            // Удаляем обоих детей родителя
-            delete parent->left;
-            delete parent->right;
-            parent->left = parent->right = nullptr;
-            size -= 2;
-        } else {
-            // Удаление корня (который является листом)
-            delete root;
-            root = nullptr;
-            size = 0;
-        }
-    } else if (target->left && target->right) {
-        // Если у цели два ребенка, находим самый правый лист и заменяем данные цели
-        Node* rightmostParent = nullptr;
-        Node* rightmost = nullptr;
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::insert(const T& value) {
+    if (!root) {
+        // Первая вставка: создаем только корень как лист (0 потомков)
+        root = arena.create(value);
+        levelOrder.push_back(root);
+        indexAdd(value, 0);
+        size = 1;
+        return;
+    }
 
-        std::queue<std::pair<Node*, Node*>> leafQueue;
-        leafQueue.push({root, nullptr});
+    // Первый лист в порядке обхода в ширину; его потомки займут индексы size и size+1
+    // Оба потомка создаются и попадают во фронт до привязки к листу:
+    // при исключении дерево остается неизменным
+    Node* leaf = levelOrder[(size - 1) / 2];
+    Node* left = arena.create(value);
+    Node* right = nullptr;
+    try {
+        right = arena.create(value);
+        levelOrder.push_back(left);
+        levelOrder.push_back(right);
+    } catch (...) {
+        levelOrder.resize(size);
+        arena.destroy(left);
+        if (right) arena.destroy(right);
+        throw;
+    }
+    leaf->left = left;
+    leaf->right = right;
+    indexAdd(value, size);
+    indexAdd(value, size + 1);
+    size += 2;
+}
 
-        while (!leafQueue.empty()) {
-            auto [current, par] = leafQueue.front();
-            leafQueue.pop();
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::remove(const T& value) {
+    if (!root) return;
 
-            if (!current->left && !current->right) {
-                rightmost = current;
-                rightmostParent = par;
-            }
+    size_t target;
+    if (!locate(value, target)) return; // Значение не найдено
 
-            if (current->left) leafQueue.push({current->left, current});
-            if (current->right) leafQueue.push({current->right, current});
+    if (size == 1) {
+        // Удаление корня (который является листом)
+        arena.destroy(root);
+        root = nullptr;
+        levelOrder.clear();
+        if constexpr (Indexed) {
+            valueIndex.clear();
         }
+        size = 0;
+        return;
+    }
+
+    // Последняя пара листьев — два последних узла фронта, их родитель — узел (size-3)/2
+    indexErase(levelOrder[size - 2]->data, size - 2);
+    indexErase(levelOrder[size - 1]->data, size - 1);
+    if (target < size - 2) {
+        indexErase(levelOrder[target]->data, target);
+        levelOrder[target]->data = levelOrder[size - 1]->data;
+        indexAdd(levelOrder[target]->data, target);
+    }
+    Node* parent = levelOrder[(size - 3) / 2];
+    arena.destroy(parent->left);
+    arena.destroy(parent->right);
+    parent->left = parent->right = nullptr;
+    levelOrder.pop_back();
+    levelOrder.pop_back();
+    size -= 2;
+}
 
-        if (rightmost && rightmost != target) {
-            // Заменяем данные цели данными самого правого листа
-            target->data = rightmost->data;
-            // Удаляем самый правый лист и его брата
-            if (rightmostParent) {
-                delete rightmostParent->left;
-                delete rightmostParent->right;
-                rightmostParent->left = rightmostParent->right = nullptr;
-                size -= 2;
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::find(const T& value) const {
+    if constexpr (Indexed) {
+        return valueIndex.find(value);
+    } else {
+        // levelOrder уже хранит узлы в порядке обхода в ширину
+        for (Node* node : levelOrder) {
+            if (node->data == value) {
+                return true;
             }
         }
+        return false;
     }
-    // Примечание: Если у узла только один ребенок, это нарушает свойство полного бинарного дерева.
-    // Этот случай не должен возникать в корректно поддерживаемом дереве.
 }
 
-template<typename T>
-bool FullBinaryTree<T>::find(const T& value) const {
-    if (!root) return false;
+// Число задач для обхода: не больше threads (0 — по числу ядер) и не больше,
+// чем диапазонов по MIN_PARALLEL_RANGE узлов; всегда хотя бы одна
+template<typename T, bool Indexed>
+size_t FullBinaryTree<T, Indexed>::taskCount(unsigned threads) const {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t ranges = (size + MIN_PARALLEL_RANGE - 1) / MIN_PARALLEL_RANGE;
+    return std::max<size_t>(1, std::min<size_t>(threads, ranges));
+}
 
-    std::queue<Node*> q;
-    q.push(root);
+// Делит levelOrder на tasks равных непрерывных диапазонов и выполняет
+// rangeFunc(begin, end, task) для каждого: первый диапазон — в текущем потоке,
+// остальные — через std::async. Диапазоны массива равны по объему работы,
+// в отличие от поддеревьев, узлы которых разбросаны по уровням.
+template<typename T, bool Indexed>
+template<typename RangeFunc>
+void FullBinaryTree<T, Indexed>::forEachRange(size_t tasks, RangeFunc rangeFunc) const {
+    if (tasks <= 1) {
+        rangeFunc(size_t(0), size, size_t(0));
+        return;
+    }
 
-    while (!q.empty()) {
-        Node* current = q.front();
-        q.pop();
+    size_t chunk = (size + tasks - 1) / tasks;
+    std::vector<std::future<void>> pending;
+    pending.reserve(tasks - 1);
+    for (size_t task = 1; task < tasks; ++task) {
+        size_t begin = task * chunk;
+        size_t end = std::min(size, begin + chunk);
+        pending.push_back(std::async(std::launch::async, [&rangeFunc, begin, end, task]() {
+            rangeFunc(begin, end, task);
+        }));
+    }
+    // Деструкторы future из std::async дожидаются задач, даже если здесь возникнет исключение
+    rangeFunc(size_t(0), std::min(size, chunk), size_t(0));
+    for (auto& future : pending) {
+        future.get();
+    }
+}
 
-        if (current->data == value) {
-            return true;
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::parallelFind(const T& value, unsigned threads) const {
+    std::atomic<bool> found(false);
+    forEachRange(taskCount(threads), [this, &value, &found](size_t begin, size_t end, size_t) {
+        const size_t CHECK_INTERVAL = 1024; // как часто смотреть, не нашла ли значение другая задача
+        for (size_t i = begin; i < end; i += CHECK_INTERVAL) {
+            if (found.load(std::memory_order_relaxed)) return;
+            size_t blockEnd = std::min(end, i + CHECK_INTERVAL);
+            for (size_t j = i; j < blockEnd; ++j) {
+                if (levelOrder[j]->data == value) {
+                    found.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
         }
+    });
+    return found.load();
+}
 
-        if (current->left) q.push(current->left);
-        if (current->right) q.push(current->right);
-    }
-
-    return false;
+template<typename T, bool Indexed>
+template<typename Func>
+void FullBinaryTree<T, Indexed>::parallelForEach(Func func, unsigned threads) const {
+    forEachRange(taskCount(threads), [this, &func](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            func(static_cast<const T&>(levelOrder[i]->data));
+        }
+    });
 }
 
-template<typename T>
-bool FullBinaryTree<T>::isFullBinaryTreeHelper(Node* node) const {
-    if (!node) return true;
+template<typename T, bool Indexed>
+template<typename R, typename Map, typename Combine>
+R FullBinaryTree<T, Indexed>::parallelReduce(R identity, Map map, Combine combine, unsigned threads) const {
+    size_t tasks = taskCount(threads);
+    struct Partial { R value; }; // обертка: std::vector<bool> нельзя писать из разных потоков
+    std::vector<Partial> partials(tasks, Partial{identity});
+    forEachRange(tasks, [this, &partials, &identity, &map, &combine](size_t begin, size_t end, size_t task) {
+        R acc = identity;
+        for (size_t i = begin; i < end; ++i) {
+            acc = combine(acc, map(levelOrder[i]->data));
+        }
+        partials[task].value = acc;
+    });
 
-    // У узла в полном бинарном дереве должно быть либо 0, либо 2 потомка
-    if ((!node->left && node->right) || (node->left && !node->right)) {
-        return false;
+    R result = identity;
+    for (size_t task = 0; task < tasks; ++task) {
+        result = combine(result, partials[task].value);
     }
-
-    return isFullBinaryTreeHelper(node->left) && isFullBinaryTreeHelper(node->right);
+    return result;
 }
 
-template<typename T>
-bool FullBinaryTree<T>::isFullBinaryTree() const {
-    return isFullBinaryTreeHelper(root);
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::isFullBinaryTree() const {
+    // У узла в полном бинарном дереве должно быть либо 0, либо 2 потомка
+    for (Node* node : levelOrder) {
+        if ((!node->left && node->right) || (node->left && !node->right)) {
+            return false;
+        }
+    }
+    return true;
 }
 
-template<typename T>
-size_t FullBinaryTree<T>::getSize() const {
+template<typename T, bool Indexed>
+size_t FullBinaryTree<T, Indexed>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool FullBinaryTree<T>::isEmpty() const {
+template<typename T, bool Indexed>
+bool FullBinaryTree<T, Indexed>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void FullBinaryTree<T>::clear() {
-    destroyTree(root);
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::clear() {
+    // Для тривиально разрушаемых данных деструкторы не нужны: арена освобождается блоками
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        destroyTree(root);
+    }
+    arena.release();
     root = nullptr;
+    levelOrder.clear();
+    if constexpr (Indexed) {
+        valueIndex.clear();
+    }
     size = 0;
 }
 
-template<typename T>
-void FullBinaryTree<T>::print() const {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::print() const {
     if (!root) {
         std::cout << "Empty tree" << std::endl;
         return;
     }
 
     std::cout << "Level-order traversal: ";
-    std::queue<Node*> q;
-    q.push(root);
-
-    while (!q.empty()) {
-        Node* current = q.front();
-        q.pop();
-
-        std::cout << current->data << " ";
-
-        if (current->left) q.push(current->left);
-        if (current->right) q.push(current->right);
-    }
-    std::cout << std::endl;
-}
-
-template<typename T>
-void FullBinaryTree<T>::printInOrderHelper(Node* node) const {
-    if (node) {
-        printInOrderHelper(node->left);
+    for (Node* node : levelOrder) {
         std::cout << node->data << " ";
-        printInOrderHelper(node->right);
     }
+    std::cout << std::endl;
 }
 
-template<typename T>
-void FullBinaryTree<T>::printInOrder() const {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::printInOrder() const {
     std::cout << "In-order traversal: ";
-    printInOrderHelper(root);
+    for (const T& value : inOrderRange()) {
+        std::cout << value << " ";
+    }
     std::cout << std::endl;
 }
 
-template<typename T>
-void FullBinaryTree<T>::serializeHelper(Node* node, std::ostream& out) const {
-    if (!node) {
-        out << "null ";
-        return;
+// Прямой обход с явным стеком; null-маркеры пишутся для отсутствующих потомков
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serializeHelper(Node* node, std::ostream& out) const {
+    std::vector<Node*> stack;
+    stack.push_back(node);
+    while (!stack.empty()) {
+        Node* current = stack.back();
+        stack.pop_back();
+        if (!current) {
+            out << "null ";
+            continue;
+        }
+        out << current->data << " ";
+        stack.push_back(current->right);
+        stack.push_back(current->left);
     }
-
-    out << node->data << " ";
-    serializeHelper(node->left, out);
-    serializeHelper(node->right, out);
 }
 
-template<typename T>
-void FullBinaryTree<T>::serialize(std::ostream& out) const {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serialize(std::ostream& out) const {
     // По умолчанию используется бинарная сериализация
     serializeBinary(out);
 }
 
-template<typename T>
-void FullBinaryTree<T>::deserialize(std::istream& in) {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::deserialize(std::istream& in) {
     // По умолчанию используется бинарная десериализация
     deserializeBinary(in);
 }
 
 // Важно: бинарная сериализация корректна только для тривиально копируемых типов
-template<typename T>
-void FullBinaryTree<T>::serializeBinary(std::ostream& out) const {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serializeBinary(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&size), sizeof(size));
     serializeBinaryHelper(root, out);
 }
 
 // Важно: бинарная десериализация корректна только для тривиально копируемых типов
-template<typename T>
-void FullBinaryTree<T>::deserializeBinary(std::istream& in) {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::deserializeBinary(std::istream& in) {
     clear();
     
     size_t new_size;
     in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
-    size = new_size;
-    
+
     root = deserializeBinaryHelper(in);
+    size = new_size;
+    restoreFrontier();
 }
 
-template<typename T>
-void FullBinaryTree<T>::serializeText(std::ostream& out) const {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serializeText(std::ostream& out) const {
     out << size << std::endl;
     serializeHelper(root, out);
     out << std::endl;
 }
 
-template<typename T>
-void FullBinaryTree<T>::deserializeText(std::istream& in) {
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::deserializeText(std::istream& in) {
     clear();
 
     size_t new_size;
     in >> new_size;
-    size = new_size;
 
     root = deserializeHelper(in);
+    size = new_size;
+    restoreFrontier();
 }
 
-template<typename T>
-typename FullBinaryTree<T>::Node* FullBinaryTree<T>::deserializeHelper(std::istream& in) {
-    std::string token;
-    if (!(in >> token) || token == "null") {
-        return nullptr;
+// Важно: компактная сериализация корректна только для тривиально копируемых типов
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serializeSuccinct(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+
+    std::vector<unsigned char> shape((size + 7) / 8, 0);
+    std::vector<T> values;
+    values.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        Node* node = levelOrder[i];
+        shape[i / 8] |= static_cast<unsigned char>((node->left ? 1u : 0u) << (i % 8));
+        values.push_back(node->data);
     }
+    out.write(reinterpret_cast<const char*>(shape.data()), shape.size());
+    out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
 
-    std::istringstream iss(token);
-    T value;
-    iss >> value;
+// Важно: компактная десериализация корректна только для тривиально копируемых типов
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::deserializeSuccinct(std::istream& in) {
+    clear();
 
-    Node* node = new Node(value);
-    node->left = deserializeHelper(in);
-    node->right = deserializeHelper(in);
+    size_t new_size = 0;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    if (!in) {
+        throw std::runtime_error("Truncated succinct tree stream");
+    }
+    if (new_size == 0) return;
+    if (new_size % 2 == 0) {
+        throw std::runtime_error("Invalid full binary tree size");
+    }
 
-    return node;
-}
+    std::vector<unsigned char> shape((new_size + 7) / 8);
+    in.read(reinterpret_cast<char*>(shape.data()), shape.size());
+    std::vector<T> values(new_size);
+    in.read(reinterpret_cast<char*>(values.data()), new_size * sizeof(T));
+    if (!in) {
+        throw std::runtime_error("Truncated succinct tree stream");
+    }
 
-template<typename T>
-void FullBinaryTree<T>::serializeBinaryHelper(Node* node, std::ostream& out) const {
-    if (!node) {
-        bool is_null = true;
-        out.write(reinterpret_cast<const char*>(&is_null), sizeof(is_null));
-        return;
+    // Узлы в порядке обхода в ширину: потомки i-го внутреннего узла — следующие два
+    // еще не привязанных узла, поэтому достаточно одного счетчика next.
+    // Сам узел i к этому моменту должен быть привязан (i < next), иначе форма
+    // описывает петлю или несвязный лес.
+    std::vector<Node*> nodes;
+    nodes.reserve(new_size);
+    try {
+        for (size_t i = 0; i < new_size; ++i) {
+            nodes.push_back(arena.create(values[i]));
+        }
+    } catch (...) {
+        for (Node* node : nodes) {
+            arena.destroy(node);
+        }
+        throw;
+    }
+    size_t next = 1;
+    bool valid = true;
+    for (size_t i = 0; i < new_size && valid; ++i) {
+        if ((shape[i / 8] >> (i % 8)) & 1u) {
+            if (i >= next || next + 2 > new_size) {
+                valid = false;
+                break;
+            }
+            nodes[i]->left = nodes[next];
+            nodes[i]->right = nodes[next + 1];
+            next += 2;
+        }
+    }
+    if (!valid || next != new_size) {
+        for (Node* node : nodes) {
+            arena.destroy(node);
+        }
+        throw std::runtime_error("Succinct shape does not describe a full binary tree");
     }
 
-    bool is_null = false;
-    out.write(reinterpret_cast<const char*>(&is_null), sizeof(is_null));
-    out.write(reinterpret_cast<const char*>(&node->data), sizeof(T));
-    serializeBinaryHelper(node->left, out);
-    serializeBinaryHelper(node->right, out);
+    root = nodes[0];
+    size = new_size;
+    restoreFrontier();
+    if (levelOrder.size() != new_size) {
+        clear();
+        throw std::runtime_error("Succinct shape does not describe a full binary tree");
+    }
 }
 
-template<typename T>
-typename FullBinaryTree<T>::Node* FullBinaryTree<T>::deserializeBinaryHelper(std::istream& in) {
-    bool is_null;
-    in.read(reinterpret_cast<char*>(&is_null), sizeof(is_null));
-    
-    if (is_null) {
-        return nullptr;
+// Восстанавливает прямой обход без рекурсии: стек хранит адреса еще не заполненных
+// ссылок на потомков. Узлы сразу привязываются к частично построенному дереву,
+// поэтому при исключении его достаточно освободить целиком.
+template<typename T, bool Indexed>
+typename FullBinaryTree<T, Indexed>::Node* FullBinaryTree<T, Indexed>::deserializeHelper(std::istream& in) {
+    Node* result = nullptr;
+    std::vector<Node**> slots;
+    slots.push_back(&result);
+    while (!slots.empty()) {
+        Node** slot = slots.back();
+        slots.pop_back();
+
+        std::string token;
+        if (!(in >> token) || token == "null") {
+            continue; // *slot уже nullptr
+        }
+
+        std::istringstream iss(token);
+        T value;
+        iss >> value;
+
+        Node* node;
+        try {
+            node = arena.create(value);
+        } catch (...) {
+            destroyTree(result);
+            throw;
+        }
+        *slot = node;
+        slots.push_back(&node->right);
+        slots.push_back(&node->left);
+    }
+    return result;
+}
+
+template<typename T, bool Indexed>
+void FullBinaryTree<T, Indexed>::serializeBinaryHelper(Node* node, std::ostream& out) const {
+    std::vector<Node*> stack;
+    stack.push_back(node);
+    while (!stack.empty()) {
+        Node* current = stack.back();
+        stack.pop_back();
+
+        bool is_null = current == nullptr;
+        out.write(reinterpret_cast<const char*>(&is_null), sizeof(is_null));
+        if (is_null) continue;
+
+        out.write(reinterpret_cast<const char*>(&current->data), sizeof(T));
+        stack.push_back(current->right);
+        stack.push_back(current->left);
     }
+}
 
-    T value;
-    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+template<typename T, bool Indexed>
+typename FullBinaryTree<T, Indexed>::Node* FullBinaryTree<T, Indexed>::deserializeBinaryHelper(std::istream& in) {
+    Node* result = nullptr;
+    std::vector<Node**> slots;
+    slots.push_back(&result);
+    while (!slots.empty()) {
+        Node** slot = slots.back();
+        slots.pop_back();
+
+        bool is_null = true; // оборванный поток читается как отсутствие потомков
+        in.read(reinterpret_cast<char*>(&is_null), sizeof(is_null));
+        if (!in || is_null) {
+            continue;
+        }
 
-    Node* node = new Node(value);
-    node->left = deserializeBinaryHelper(in);
-    node->right = deserializeBinaryHelper(in);
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
 
-    return node;
-}
\ No newline at end of file
+        Node* node;
+        try {
+            node = arena.create(value);
+        } catch (...) {
+            destroyTree(result);
+            throw;
+        }
+        *slot = node;
+        slots.push_back(&node->right);
+        slots.push_back(&node->left);
+    }
+    return result;
+}
@@ -66,6 +66,12 @@ public:
      */
     ~HashTable();
 
+    /**
+     * @brief Обменивается содержимым с другой таблицей за O(1). Не выбрасывает исключений.
+     * @param other Другая таблица.
+     */
+    void swap(HashTable& other) noexcept;
+
     /**
      * @brief Вставляет или обновляет пару ключ-значение.
      * Если ключ уже существует, его значение обновляется.
@@ -240,9 +246,7 @@ HashTable<K, V>& HashTable<K, V>::operator=(const HashTable& other) {
 
         // 2. Меняем местами внутренние ресурсы this и временного объекта.
         // Операции swap не выбрасывают исключений.
-        std::swap(buckets, temp.buckets);
-        std::swap(bucket_count, temp.bucket_count);
-        std::swap(size, temp.size);
+        swap(temp);
 
         // 3. При выходе из if деструктор temp очистит старые ресурсы (которые теперь в temp).
     }
@@ -255,6 +259,13 @@ HashTable<K, V>::~HashTable() {
     delete[] buckets;
 }
 
+template<typename K, typename V>
+void HashTable<K, V>::swap(HashTable& other) noexcept {
+    std::swap(buckets, other.buckets);
+    std::swap(bucket_count, other.bucket_count);
+    std::swap(size, other.size);
+}
+
 template<typename K, typename V>
 size_t HashTable<K, V>::hash(const K& key) const {
     return std::hash<K>{}(key) % bucket_count;
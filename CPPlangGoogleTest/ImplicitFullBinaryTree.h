@@ -0,0 +1,322 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include "Array.h"
+
+/**
+ * @brief Полное бинарное дерево с неявным (массивным) хранением узлов.
+ *
+ * Альтернатива FullBinaryTree с той же семантикой вставки: значение добавляется
+ * двумя потомками к первому листу в порядке обхода в ширину. При такой вставке
+ * узлы всегда занимают префикс массива в "кучевой" нумерации: потомки узла i
+ * находятся по индексам 2i+1 и 2i+2, родитель — по индексу (i-1)/2.
+ * Поэтому указатели не хранятся, первый свободный лист — это узел (size-1)/2,
+ * вставка выполняется за O(1) амортизированно, а обход в ширину — это проход по массиву.
+ *
+ * @tparam T Тип хранимых данных. Должен быть копируемым и конструируемым по умолчанию.
+ * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
+ */
+template<typename T>
+class ImplicitFullBinaryTree {
+private:
+    Array<T> nodes; ///< Узлы в порядке обхода в ширину
+
+    void printInOrderHelper(size_t index) const;
+
+public:
+    /**
+     * @brief Индекс левого потомка узла.
+     * @param index Индекс узла.
+     */
+    static size_t leftChild(size_t index) { return 2 * index + 1; }
+
+    /**
+     * @brief Индекс правого потомка узла.
+     * @param index Индекс узла.
+     */
+    static size_t rightChild(size_t index) { return 2 * index + 2; }
+
+    /**
+     * @brief Индекс родителя узла (для index > 0).
+     * @param index Индекс узла.
+     */
+    static size_t parent(size_t index) { return (index - 1) / 2; }
+
+    /**
+     * @brief Вставляет значение в дерево. Сложность: O(1) амортизированно.
+     * Первое значение становится корнем; каждое следующее добавляется двумя
+     * потомками к первому листу в порядке обхода в ширину (как в FullBinaryTree).
+     * @param value Значение для вставки.
+     */
+    void insert(const T& value);
+
+    /**
+     * @brief Удаляет первое (в порядке обхода в ширину) вхождение значения.
+     * Чтобы узлы по-прежнему занимали префикс массива, значение удаляемого узла
+     * замещается значением последнего листа, после чего последняя пара листьев
+     * удаляется. Если узел сам входит в последнюю пару, удаляется только она.
+     * Сложность: O(N) на поиск, O(1) на удаление.
+     * @param value Значение для удаления.
+     */
+    void remove(const T& value);
+
+    /**
+     * @brief Ищет значение в дереве. Сложность: O(N), последовательный проход по массиву.
+     * @param value Искомое значение.
+     * @return true, если значение найдено.
+     */
+    bool find(const T& value) const;
+
+    /**
+     * @brief Возвращает узел по индексу в порядке обхода в ширину.
+     * @param index Индекс узла.
+     * @return const T& Константная ссылка на значение узла.
+     * @throw std::out_of_range Если index >= size.
+     */
+    const T& get(size_t index) const;
+
+    /**
+     * @brief Проверяет, является ли узел листом.
+     * @param index Индекс узла.
+     * @return true, если у узла нет потомков.
+     * @throw std::out_of_range Если index >= size.
+     */
+    bool isLeaf(size_t index) const;
+
+    /**
+     * @brief Проверяет корректность структуры полного бинарного дерева.
+     * При неявном хранении размер дерева всегда нечетен (или 0), поэтому
+     * у каждого узла 0 или 2 потомка.
+     * @return true, если у каждого узла либо 0, либо 2 потомка.
+     */
+    bool isFullBinaryTree() const;
+
+    /**
+     * @brief Возвращает текущее количество узлов.
+     * @return Размер дерева.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пусто ли дерево.
+     * @return true, если в дереве нет узлов.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Очищает дерево.
+     */
+    void clear();
+
+    /**
+     * @brief Выводит содержимое дерева (обход в ширину).
+     */
+    void print() const;
+
+    /**
+     * @brief Выводит содержимое дерева (симметричный обход / In-Order).
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Универсальная сериализация (обертка над serializeBinary).
+     * @param out Поток вывода.
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Универсальная десериализация (обертка над deserializeBinary).
+     * @param in Поток ввода.
+     */
+    void deserialize(std::istream& in);
+
+    /**
+     * @brief Бинарная сериализация: размер и значения в порядке обхода в ширину.
+     * Форма дерева однозначно задается размером, поэтому маркеры null не нужны.
+     * @note Предназначена для тривиально копируемых типов (POD).
+     * @param out Поток вывода.
+     */
+    void serializeBinary(std::ostream& out) const;
+
+    /**
+     * @brief Бинарная десериализация.
+     * @note Ожидает данные тривиально копируемых типов (POD).
+     * @param in Поток ввода.
+     * @throw std::runtime_error Если размер не соответствует полному дереву.
+     */
+    void deserializeBinary(std::istream& in);
+
+    /**
+     * @brief Текстовая сериализация. Формат: <размер>\n<значения в порядке обхода в ширину>\n
+     * @param out Поток вывода.
+     */
+    void serializeText(std::ostream& out) const;
+
+    /**
+     * @brief Текстовая десериализация.
+     * @param in Поток ввода.
+     * @throw std::runtime_error Если размер не соответствует полному дереву.
+     */
+    void deserializeText(std::istream& in);
+};
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::insert(const T& value) {
+    // Первый свободный лист — узел (size-1)/2, его потомки — ровно size и size+1
+    nodes.add(value);
+    if (nodes.getSize() > 1) {
+        nodes.add(value);
+    }
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::remove(const T& value) {
+    size_t size = nodes.getSize();
+    size_t target = 0;
+    while (target < size && !(nodes.get(target) == value)) {
+        ++target;
+    }
+    if (target == size) return; // Значение не найдено
+
+    if (size == 1) {
+        nodes.clear();
+        return;
+    }
+    if (target < size - 2) {
+        nodes.set(target, nodes.get(size - 1));
+    }
+    nodes.remove(size - 1);
+    nodes.remove(size - 2);
+}
+
+template<typename T>
+bool ImplicitFullBinaryTree<T>::find(const T& value) const {
+    for (size_t i = 0; i < nodes.getSize(); ++i) {
+        if (nodes.get(i) == value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+const T& ImplicitFullBinaryTree<T>::get(size_t index) const {
+    return nodes.get(index);
+}
+
+template<typename T>
+bool ImplicitFullBinaryTree<T>::isLeaf(size_t index) const {
+    if (index >= nodes.getSize()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return leftChild(index) >= nodes.getSize();
+}
+
+template<typename T>
+bool ImplicitFullBinaryTree<T>::isFullBinaryTree() const {
+    return nodes.getSize() == 0 || nodes.getSize() % 2 == 1;
+}
+
+template<typename T>
+size_t ImplicitFullBinaryTree<T>::getSize() const {
+    return nodes.getSize();
+}
+
+template<typename T>
+bool ImplicitFullBinaryTree<T>::isEmpty() const {
+    return nodes.getSize() == 0;
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::clear() {
+    nodes.clear();
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::print() const {
+    if (nodes.getSize() == 0) {
+        std::cout << "Empty tree" << std::endl;
+        return;
+    }
+
+    std::cout << "Level-order traversal: ";
+    for (size_t i = 0; i < nodes.getSize(); ++i) {
+        std::cout << nodes.get(i) << " ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::printInOrderHelper(size_t index) const {
+    if (index < nodes.getSize()) {
+        printInOrderHelper(leftChild(index));
+        std::cout << nodes.get(index) << " ";
+        printInOrderHelper(rightChild(index));
+    }
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::printInOrder() const {
+    std::cout << "In-order traversal: ";
+    printInOrderHelper(0);
+    std::cout << std::endl;
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::serialize(std::ostream& out) const {
+    serializeBinary(out);
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::deserialize(std::istream& in) {
+    deserializeBinary(in);
+}
+
+// Важно: бинарная сериализация корректна только для тривиально копируемых типов
+template<typename T>
+void ImplicitFullBinaryTree<T>::serializeBinary(std::ostream& out) const {
+    size_t size = nodes.getSize();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (size_t i = 0; i < size; ++i) {
+        out.write(reinterpret_cast<const char*>(&nodes.get(i)), sizeof(T));
+    }
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::deserializeBinary(std::istream& in) {
+    clear();
+    size_t new_size;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    if (new_size % 2 == 0 && new_size != 0) {
+        throw std::runtime_error("Invalid full binary tree size");
+    }
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        nodes.add(value);
+    }
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::serializeText(std::ostream& out) const {
+    out << nodes.getSize() << std::endl;
+    for (size_t i = 0; i < nodes.getSize(); ++i) {
+        out << nodes.get(i) << " ";
+    }
+    out << std::endl;
+}
+
+template<typename T>
+void ImplicitFullBinaryTree<T>::deserializeText(std::istream& in) {
+    clear();
+    size_t new_size;
+    in >> new_size;
+    if (new_size % 2 == 0 && new_size != 0) {
+        throw std::runtime_error("Invalid full binary tree size");
+    }
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in >> value;
+        nodes.add(value);
+    }
+}
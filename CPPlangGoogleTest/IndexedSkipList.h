@@ -0,0 +1,566 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief Индексируемый список с пропусками (Indexable Skip List).
+ *
+ * Последовательный контейнер с тем же интерфейсом, что у DoubleList
+ * (pushFront/pushBack/insert/remove/get), но позиционные операции выполняются
+ * за ожидаемое O(log N) вместо O(N).
+ *
+ * Каждый узел получает случайное количество уровней (вероятность 1/2 на уровень).
+ * Ссылка уровня хранит ширину — число элементов нулевого уровня, которое она перепрыгивает,
+ * поэтому позицию можно найти, суммируя ширины при спуске сверху вниз.
+ *
+ * @tparam T Тип элементов. Должен быть копируемым и конструируемым по умолчанию.
+ * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
+ */
+template<typename T>
+class IndexedSkipList {
+private:
+    static constexpr int MAX_LEVEL = 32;
+
+    struct Node;
+    struct Link {
+        Node* next;
+        size_t width; ///< Число шагов нулевого уровня до next (или до конца списка)
+    };
+
+    // Ссылки уровней размещаются сразу за узлом в одном блоке памяти
+    struct alignas(Link) Node {
+        T data;
+        int level;
+        Node(const T& value, int levels) : data(value), level(levels) {}
+        Link* links() { return reinterpret_cast<Link*>(this + 1); }
+    };
+
+    Node* head;      ///< Фиктивный узел с MAX_LEVEL уровнями (позиция 0)
+    Node* tail;      ///< Последний элемент (nullptr для пустого списка)
+    size_t size;     ///< Текущее количество элементов
+    int levelCount;  ///< Количество используемых уровней
+    uint64_t seed;   ///< Состояние генератора уровней (xorshift64)
+
+    static Node* createNode(const T& value, int levels);
+    static void destroyNode(Node* node);
+    int randomLevel();
+    Node* nodeAt(size_t position) const;
+    void init();
+
+public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой список.
+     */
+    IndexedSkipList();
+
+    /**
+     * @brief Копирующий конструктор.
+     * @param other Список-источник.
+     */
+    IndexedSkipList(const IndexedSkipList& other);
+
+    /**
+     * @brief Оператор присваивания (copy-and-swap).
+     * @param other Список-источник.
+     * @return Ссылка на текущий объект.
+     */
+    IndexedSkipList& operator=(const IndexedSkipList& other);
+
+    /**
+     * @brief Деструктор. Освобождает все узлы.
+     */
+    ~IndexedSkipList();
+
+    /**
+     * @brief Добавляет элемент в начало списка. Сложность: O(log N).
+     * @param element Значение для добавления.
+     */
+    void pushFront(const T& element);
+
+    /**
+     * @brief Добавляет элемент в конец списка. Сложность: O(log N).
+     * @param element Значение для добавления.
+     */
+    void pushBack(const T& element);
+
+    /**
+     * @brief Вставляет элемент по индексу. Сложность: O(log N).
+     * @param index Позиция вставки (0 - начало, size - конец).
+     * @param element Значение для вставки.
+     * @throw std::out_of_range Если index > size.
+     */
+    void insert(size_t index, const T& element);
+
+    /**
+     * @brief Удаляет первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popFront();
+
+    /**
+     * @brief Удаляет последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popBack();
+
+    /**
+     * @brief Удаляет элемент по индексу. Сложность: O(log N).
+     * @param index Индекс удаляемого элемента.
+     * @throw std::out_of_range Если index >= size.
+     */
+    void remove(size_t index);
+
+    /**
+     * @brief Возвращает ссылку на элемент по индексу. Сложность: O(log N).
+     * @param index Индекс элемента.
+     * @return T& Ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    T& get(size_t index);
+
+    /**
+     * @brief Возвращает константную ссылку на элемент по индексу.
+     * @param index Индекс элемента.
+     * @return const T& Константная ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    const T& get(size_t index) const;
+
+    /**
+     * @brief Возвращает первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    /**
+     * @brief Возвращает количество элементов.
+     * @return Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Возвращает количество используемых уровней.
+     * @return Высота списка (около log2(N)).
+     */
+    int getLevelCount() const;
+
+    /**
+     * @brief Удаляет все элементы.
+     */
+    void clear();
+
+    /**
+     * @brief Линейный поиск значения.
+     * @param value Искомое значение.
+     * @return true, если значение найдено.
+     */
+    bool find(const T& value) const;
+
+    /**
+     * @brief Выводит элементы списка. Формат: [e1 -> e2 -> e3]
+     */
+    void print() const;
+
+    /**
+     * @brief Сериализация (обертка над serializeBinary).
+     * @param out Поток вывода.
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Десериализация (обертка над deserializeBinary).
+     * @param in Поток ввода.
+     */
+    void deserialize(std::istream& in);
+
+    /**
+     * @brief Бинарная сериализация: размер и значения по порядку. Уровни не сохраняются.
+     * @warning Только для POD-типов.
+     * @param out Поток вывода.
+     */
+    void serializeBinary(std::ostream& out) const;
+
+    /**
+     * @brief Бинарная десериализация. Очищает список и восстанавливает элементы.
+     * @warning Только для POD-типов.
+     * @param in Поток ввода.
+     */
+    void deserializeBinary(std::istream& in);
+
+    /**
+     * @brief Текстовая сериализация. Формат: <размер>\n<значения через пробел>\n
+     * @param out Поток вывода.
+     */
+    void serializeText(std::ostream& out) const;
+
+    /**
+     * @brief Текстовая десериализация.
+     * @param in Поток ввода.
+     */
+    void deserializeText(std::istream& in);
+};
+
+template<typename T>
+typename IndexedSkipList<T>::Node* IndexedSkipList<T>::createNode(const T& value, int levels) {
+    void* memory = ::operator new(sizeof(Node) + levels * sizeof(Link));
+    Node* node;
+    try {
+        node = new (memory) Node(value, levels);
+    } catch (...) {
+        ::operator delete(memory);
+        throw;
+    }
+    for (int i = 0; i < levels; ++i) {
+        node->links()[i] = Link{nullptr, 0};
+    }
+    return node;
+}
+
+template<typename T>
+void IndexedSkipList<T>::destroyNode(Node* node) {
+    node->~Node();
+    ::operator delete(node);
+}
+
+template<typename T>
+int IndexedSkipList<T>::randomLevel() {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    // Число младших единичных битов дает геометрическое распределение с p = 1/2
+    uint64_t bits = seed;
+    int level = 1;
+    while ((bits & 1) && level < MAX_LEVEL) {
+        ++level;
+        bits >>= 1;
+    }
+    return level;
+}
+
+template<typename T>
+void IndexedSkipList<T>::init() {
+    head = createNode(T(), MAX_LEVEL);
+    tail = nullptr;
+    size = 0;
+    levelCount = 1;
+    head->links()[0].width = 1;
+}
+
+template<typename T>
+IndexedSkipList<T>::IndexedSkipList() : seed(0x9E3779B97F4A7C15ULL) {
+    init();
+}
+
+template<typename T>
+IndexedSkipList<T>::IndexedSkipList(const IndexedSkipList& other) : seed(other.seed) {
+    init();
+    try {
+        for (Node* current = other.head->links()[0].next; current; current = current->links()[0].next) {
+            pushBack(current->data);
+        }
+    } catch (...) {
+        clear();
+        destroyNode(head);
+        throw;
+    }
+}
+
+template<typename T>
+IndexedSkipList<T>& IndexedSkipList<T>::operator=(const IndexedSkipList& other) {
+    if (this != &other) {
+        IndexedSkipList temp(other);
+        Node* tHead = head; head = temp.head; temp.head = tHead;
+        Node* tTail = tail; tail = temp.tail; temp.tail = tTail;
+        size_t tSize = size; size = temp.size; temp.size = tSize;
+        int tLevels = levelCount; levelCount = temp.levelCount; temp.levelCount = tLevels;
+    }
+    return *this;
+}
+
+template<typename T>
+IndexedSkipList<T>::~IndexedSkipList() {
+    clear();
+    destroyNode(head);
+}
+
+// Позиция 0 — фиктивная голова, элемент с индексом i находится на позиции i + 1
+template<typename T>
+typename IndexedSkipList<T>::Node* IndexedSkipList<T>::nodeAt(size_t position) const {
+    Node* current = head;
+    size_t traversed = 0;
+    for (int level = levelCount - 1; level >= 0; --level) {
+        Link* link = &current->links()[level];
+        while (link->next && traversed + link->width <= position) {
+            traversed += link->width;
+            current = link->next;
+            link = &current->links()[level];
+        }
+        if (traversed == position) break;
+    }
+    return current;
+}
+
+template<typename T>
+void IndexedSkipList<T>::insert(size_t index, const T& element) {
+    if (index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    // Для каждого уровня — последний узел не правее позиции index и его позиция
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    Node* current = head;
+    size_t traversed = 0;
+    for (int level = levelCount - 1; level >= 0; --level) {
+        Link* link = &current->links()[level];
+        while (link->next && traversed + link->width <= index) {
+            traversed += link->width;
+            current = link->next;
+            link = &current->links()[level];
+        }
+        update[level] = current;
+        rank[level] = traversed;
+    }
+
+    int newLevel = randomLevel();
+    Node* node = createNode(element, newLevel);
+    if (newLevel > levelCount) {
+        for (int level = levelCount; level < newLevel; ++level) {
+            update[level] = head;
+            rank[level] = 0;
+            head->links()[level] = Link{nullptr, size + 1};
+        }
+        levelCount = newLevel;
+    }
+
+    // Новый узел займет позицию index + 1
+    for (int level = 0; level < newLevel; ++level) {
+        Link& before = update[level]->links()[level];
+        node->links()[level].next = before.next;
+        node->links()[level].width = before.width - (index - rank[level]);
+        before.next = node;
+        before.width = index + 1 - rank[level];
+    }
+    for (int level = newLevel; level < levelCount; ++level) {
+        ++update[level]->links()[level].width;
+    }
+
+    if (!node->links()[0].next) tail = node;
+    ++size;
+}
+
+template<typename T>
+void IndexedSkipList<T>::remove(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    // Для каждого уровня — последний узел строго левее удаляемой позиции index + 1
+    Node* update[MAX_LEVEL];
+    Node* current = head;
+    size_t traversed = 0;
+    for (int level = levelCount - 1; level >= 0; --level) {
+        Link* link = &current->links()[level];
+        while (link->next && traversed + link->width <= index) {
+            traversed += link->width;
+            current = link->next;
+            link = &current->links()[level];
+        }
+        update[level] = current;
+    }
+
+    Node* target = update[0]->links()[0].next;
+    for (int level = 0; level < levelCount; ++level) {
+        Link& before = update[level]->links()[level];
+        if (before.next == target) {
+            before.width += target->links()[level].width - 1;
+            before.next = target->links()[level].next;
+        } else {
+            --before.width;
+        }
+    }
+    while (levelCount > 1 && !head->links()[levelCount - 1].next) {
+        --levelCount;
+    }
+
+    if (target == tail) {
+        tail = update[0] == head ? nullptr : update[0];
+    }
+    destroyNode(target);
+    --size;
+}
+
+template<typename T>
+void IndexedSkipList<T>::pushFront(const T& element) {
+    insert(0, element);
+}
+
+template<typename T>
+void IndexedSkipList<T>::pushBack(const T& element) {
+    insert(size, element);
+}
+
+template<typename T>
+void IndexedSkipList<T>::popFront() {
+    if (size == 0) {
+        throw std::runtime_error("List is empty");
+    }
+    remove(0);
+}
+
+template<typename T>
+void IndexedSkipList<T>::popBack() {
+    if (size == 0) {
+        throw std::runtime_error("List is empty");
+    }
+    remove(size - 1);
+}
+
+template<typename T>
+T& IndexedSkipList<T>::get(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return nodeAt(index + 1)->data;
+}
+
+template<typename T>
+const T& IndexedSkipList<T>::get(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return nodeAt(index + 1)->data;
+}
+
+template<typename T>
+T& IndexedSkipList<T>::front() {
+    if (size == 0) {
+        throw std::runtime_error("List is empty");
+    }
+    return head->links()[0].next->data;
+}
+
+template<typename T>
+T& IndexedSkipList<T>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail->data;
+}
+
+template<typename T>
+size_t IndexedSkipList<T>::getSize() const {
+    return size;
+}
+
+template<typename T>
+bool IndexedSkipList<T>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T>
+int IndexedSkipList<T>::getLevelCount() const {
+    return levelCount;
+}
+
+template<typename T>
+void IndexedSkipList<T>::clear() {
+    Node* current = head->links()[0].next;
+    while (current) {
+        Node* next = current->links()[0].next;
+        destroyNode(current);
+        current = next;
+    }
+    for (int level = 0; level < MAX_LEVEL; ++level) {
+        head->links()[level] = Link{nullptr, 0};
+    }
+    head->links()[0].width = 1;
+    levelCount = 1;
+    tail = nullptr;
+    size = 0;
+}
+
+template<typename T>
+bool IndexedSkipList<T>::find(const T& value) const {
+    for (Node* current = head->links()[0].next; current; current = current->links()[0].next) {
+        if (current->data == value) return true;
+    }
+    return false;
+}
+
+template<typename T>
+void IndexedSkipList<T>::print() const {
+    std::cout << "[";
+    for (Node* current = head->links()[0].next; current; current = current->links()[0].next) {
+        std::cout << current->data;
+        if (current->links()[0].next) std::cout << " -> ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+template<typename T>
+void IndexedSkipList<T>::serialize(std::ostream& out) const {
+    serializeBinary(out);
+}
+
+template<typename T>
+void IndexedSkipList<T>::deserialize(std::istream& in) {
+    deserializeBinary(in);
+}
+
+// Важно: бинарная сериализация корректна только для тривиально копируемых типов
+template<typename T>
+void IndexedSkipList<T>::serializeBinary(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (Node* current = head->links()[0].next; current; current = current->links()[0].next) {
+        out.write(reinterpret_cast<const char*>(&current->data), sizeof(T));
+    }
+}
+
+template<typename T>
+void IndexedSkipList<T>::deserializeBinary(std::istream& in) {
+    clear();
+    size_t new_size;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        pushBack(value);
+    }
+}
+
+template<typename T>
+void IndexedSkipList<T>::serializeText(std::ostream& out) const {
+    out << size << std::endl;
+    for (Node* current = head->links()[0].next; current; current = current->links()[0].next) {
+        out << current->data;
+        if (current->links()[0].next) out << " ";
+    }
+    out << std::endl;
+}
+
+template<typename T>
+void IndexedSkipList<T>::deserializeText(std::istream& in) {
+    clear();
+    size_t new_size;
+    in >> new_size;
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in >> value;
+        pushBack(value);
+    }
+}
@@ -0,0 +1,597 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <iterator>
+
+/**
+ * @brief Звено односвязного интрузивного списка, встраиваемое в пользовательскую структуру.
+ *
+ * Объект может одновременно состоять в нескольких списках, если в нем есть
+ * отдельное звено для каждого из них.
+ *
+ * @tparam T Тип объекта, содержащего звено.
+ */
+template<typename T>
+struct IntrusiveForwardHook {
+    T* next = nullptr;            ///< Следующий объект списка
+    const void* owner = nullptr;  ///< Список, в котором состоит объект (nullptr — ни в каком)
+
+    IntrusiveForwardHook() = default;
+    // Копия объекта не наследует членство в списке оригинала
+    IntrusiveForwardHook(const IntrusiveForwardHook&) {}
+    IntrusiveForwardHook& operator=(const IntrusiveForwardHook&) { return *this; }
+};
+
+/**
+ * @brief Звено двусвязного интрузивного списка, встраиваемое в пользовательскую структуру.
+ * @tparam T Тип объекта, содержащего звено.
+ */
+template<typename T>
+struct IntrusiveListHook {
+    T* next = nullptr;   ///< Следующий объект списка
+    T* prev = nullptr;            ///< Предыдущий объект списка
+    const void* owner = nullptr;  ///< Список, в котором состоит объект (nullptr — ни в каком)
+
+    IntrusiveListHook() = default;
+    IntrusiveListHook(const IntrusiveListHook&) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+};
+
+/**
+ * @brief Однонаправленный итератор интрузивного списка.
+ * @tparam T Тип объекта.
+ * @tparam HookType Тип звена.
+ * @tparam Hook Указатель на поле-звено внутри T.
+ */
+template<typename T, typename HookType, HookType T::*Hook>
+class IntrusiveIterator {
+private:
+    T* object;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    explicit IntrusiveIterator(T* o = nullptr) : object(o) {}
+
+    reference operator*() const { return *object; }
+    pointer operator->() const { return object; }
+
+    IntrusiveIterator& operator++() {
+        object = (object->*Hook).next;
+        return *this;
+    }
+
+    IntrusiveIterator operator++(int) {
+        IntrusiveIterator copy = *this;
+        object = (object->*Hook).next;
+        return copy;
+    }
+
+    bool operator==(const IntrusiveIterator& other) const { return object == other.object; }
+    bool operator!=(const IntrusiveIterator& other) const { return object != other.object; }
+};
+
+/**
+ * @brief Интрузивный односвязный список.
+ *
+ * Не владеет объектами и не выделяет память: связи хранятся в звене Hook внутри
+ * самого объекта. Вставка в начало и в конец — O(1), удаление по ссылке — O(N),
+ * так как для отцепления нужен предыдущий элемент.
+ *
+ * Объект должен пережить свое пребывание в списке. Деструктор списка
+ * только сбрасывает звенья оставшихся объектов.
+ *
+ * @tparam T Тип объекта.
+ * @tparam Hook Указатель на поле IntrusiveForwardHook<T> внутри T.
+ */
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+class IntrusiveForwardList {
+private:
+    T* head;     ///< Первый объект списка
+    T* tail;     ///< Последний объект списка
+    size_t size; ///< Текущее количество элементов
+
+    static IntrusiveForwardHook<T>& hook(T& object) { return object.*Hook; }
+    void link(T& object);
+
+public:
+    using iterator = IntrusiveIterator<T, IntrusiveForwardHook<T>, Hook>;
+
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой список.
+     */
+    IntrusiveForwardList();
+
+    IntrusiveForwardList(const IntrusiveForwardList&) = delete;
+    IntrusiveForwardList& operator=(const IntrusiveForwardList&) = delete;
+
+    /**
+     * @brief Деструктор. Отцепляет все объекты, не уничтожая их.
+     */
+    ~IntrusiveForwardList();
+
+    /**
+     * @brief Добавляет объект в начало списка. Сложность: O(1).
+     * @param object Объект, не состоящий в списке по этому звену.
+     * @throw std::runtime_error Если объект уже связан через Hook.
+     */
+    void pushFront(T& object);
+
+    /**
+     * @brief Добавляет объект в конец списка. Сложность: O(1).
+     * @param object Объект, не состоящий в списке по этому звену.
+     * @throw std::runtime_error Если объект уже связан через Hook.
+     */
+    void pushBack(T& object);
+
+    /**
+     * @brief Вставляет объект после pos. Сложность: O(1).
+     * @param pos Объект, состоящий в этом списке.
+     * @param object Вставляемый объект.
+     * @throw std::runtime_error Если object уже связан или pos не состоит в этом списке.
+     */
+    void insertAfter(T& pos, T& object);
+
+    /**
+     * @brief Отцепляет первый объект. Сложность: O(1).
+     * @return Ссылка на отцепленный объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& popFront();
+
+    /**
+     * @brief Отцепляет объект по ссылке. Сложность: O(N).
+     * @param object Объект этого списка.
+     * @return true, если объект отцеплен; false, если он не состоит в этом списке.
+     */
+    bool remove(T& object);
+
+    /**
+     * @brief Проверяет, связан ли объект через звено Hook.
+     * @param object Проверяемый объект.
+     * @return true, если объект состоит в каком-либо списке по этому звену.
+     */
+    static bool isLinked(const T& object);
+
+    /**
+     * @brief Возвращает первый объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает последний объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Возвращает количество элементов.
+     * @return Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Отцепляет все объекты. Сложность: O(N).
+     */
+    void clear();
+
+    /**
+     * @brief Выводит объекты списка (требует operator<< для T).
+     */
+    void print() const;
+};
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+IntrusiveForwardList<T, Hook>::IntrusiveForwardList() : head(nullptr), tail(nullptr), size(0) {}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+IntrusiveForwardList<T, Hook>::~IntrusiveForwardList() {
+    clear();
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::link(T& object) {
+    IntrusiveForwardHook<T>& h = hook(object);
+    if (h.owner) {
+        throw std::runtime_error("Object is already linked");
+    }
+    h.owner = this;
+    h.next = nullptr;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::pushFront(T& object) {
+    link(object);
+    hook(object).next = head;
+    head = &object;
+    if (!tail) tail = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::pushBack(T& object) {
+    link(object);
+    if (tail) hook(*tail).next = &object;
+    else head = &object;
+    tail = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::insertAfter(T& pos, T& object) {
+    if (hook(pos).owner != this) {
+        throw std::runtime_error("Position is not linked into this list");
+    }
+    link(object);
+    hook(object).next = hook(pos).next;
+    hook(pos).next = &object;
+    if (tail == &pos) tail = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+T& IntrusiveForwardList<T, Hook>::popFront() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    T& object = *head;
+    head = hook(object).next;
+    if (!head) tail = nullptr;
+    hook(object).next = nullptr;
+    hook(object).owner = nullptr;
+    --size;
+    return object;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+bool IntrusiveForwardList<T, Hook>::remove(T& object) {
+    if (hook(object).owner != this) return false; // объект не состоит в этом списке
+    if (head == &object) {
+        popFront();
+        return true;
+    }
+    T* prev = head;
+    while (hook(*prev).next && hook(*prev).next != &object) {
+        prev = hook(*prev).next;
+    }
+    if (!hook(*prev).next) return false;
+
+    hook(*prev).next = hook(object).next;
+    if (tail == &object) tail = prev;
+    hook(object).next = nullptr;
+    hook(object).owner = nullptr;
+    --size;
+    return true;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+bool IntrusiveForwardList<T, Hook>::isLinked(const T& object) {
+    return (object.*Hook).owner != nullptr;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+T& IntrusiveForwardList<T, Hook>::front() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    return *head;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+T& IntrusiveForwardList<T, Hook>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return *tail;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+size_t IntrusiveForwardList<T, Hook>::getSize() const {
+    return size;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+bool IntrusiveForwardList<T, Hook>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::clear() {
+    while (head) {
+        T* next = hook(*head).next;
+        hook(*head).next = nullptr;
+        hook(*head).owner = nullptr;
+        head = next;
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+template<typename T, IntrusiveForwardHook<T> T::*Hook>
+void IntrusiveForwardList<T, Hook>::print() const {
+    std::cout << "[";
+    for (const T* current = head; current; current = (current->*Hook).next) {
+        std::cout << *current;
+        if ((current->*Hook).next) std::cout << " -> ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+/**
+ * @brief Интрузивный двусвязный список.
+ *
+ * Не владеет объектами и не выделяет память. Вставка в любую позицию, заданную
+ * объектом-соседом, и удаление по ссылке выполняются за O(1).
+ *
+ * @tparam T Тип объекта.
+ * @tparam Hook Указатель на поле IntrusiveListHook<T> внутри T.
+ */
+template<typename T, IntrusiveListHook<T> T::*Hook>
+class IntrusiveDoubleList {
+private:
+    T* head;     ///< Первый объект списка
+    T* tail;     ///< Последний объект списка
+    size_t size; ///< Текущее количество элементов
+
+    static IntrusiveListHook<T>& hook(T& object) { return object.*Hook; }
+    void link(T& object);
+
+public:
+    using iterator = IntrusiveIterator<T, IntrusiveListHook<T>, Hook>;
+
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой список.
+     */
+    IntrusiveDoubleList();
+
+    IntrusiveDoubleList(const IntrusiveDoubleList&) = delete;
+    IntrusiveDoubleList& operator=(const IntrusiveDoubleList&) = delete;
+
+    /**
+     * @brief Деструктор. Отцепляет все объекты, не уничтожая их.
+     */
+    ~IntrusiveDoubleList();
+
+    /**
+     * @brief Добавляет объект в начало списка. Сложность: O(1).
+     * @param object Объект, не состоящий в списке по этому звену.
+     * @throw std::runtime_error Если объект уже связан через Hook.
+     */
+    void pushFront(T& object);
+
+    /**
+     * @brief Добавляет объект в конец списка. Сложность: O(1).
+     * @param object Объект, не состоящий в списке по этому звену.
+     * @throw std::runtime_error Если объект уже связан через Hook.
+     */
+    void pushBack(T& object);
+
+    /**
+     * @brief Вставляет объект перед pos. Сложность: O(1).
+     * @param pos Объект, состоящий в этом списке.
+     * @param object Вставляемый объект.
+     * @throw std::runtime_error Если object уже связан или pos не состоит в этом списке.
+     */
+    void insertBefore(T& pos, T& object);
+
+    /**
+     * @brief Отцепляет первый объект. Сложность: O(1).
+     * @return Ссылка на отцепленный объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& popFront();
+
+    /**
+     * @brief Отцепляет последний объект. Сложность: O(1).
+     * @return Ссылка на отцепленный объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& popBack();
+
+    /**
+     * @brief Отцепляет объект по ссылке. Сложность: O(1).
+     * Объект должен состоять именно в этом списке.
+     * @param object Отцепляемый объект.
+     * @throw std::runtime_error Если объект не состоит в этом списке.
+     */
+    void remove(T& object);
+
+    /**
+     * @brief Проверяет, связан ли объект через звено Hook.
+     * @param object Проверяемый объект.
+     * @return true, если объект состоит в каком-либо списке по этому звену.
+     */
+    static bool isLinked(const T& object);
+
+    /**
+     * @brief Возвращает первый объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает последний объект.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Возвращает количество элементов.
+     * @return Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Отцепляет все объекты. Сложность: O(N).
+     */
+    void clear();
+
+    /**
+     * @brief Выводит объекты списка (требует operator<< для T).
+     */
+    void print() const;
+};
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+IntrusiveDoubleList<T, Hook>::IntrusiveDoubleList() : head(nullptr), tail(nullptr), size(0) {}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+IntrusiveDoubleList<T, Hook>::~IntrusiveDoubleList() {
+    clear();
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::link(T& object) {
+    IntrusiveListHook<T>& h = hook(object);
+    if (h.owner) {
+        throw std::runtime_error("Object is already linked");
+    }
+    h.owner = this;
+    h.next = h.prev = nullptr;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::pushFront(T& object) {
+    link(object);
+    hook(object).next = head;
+    if (head) hook(*head).prev = &object;
+    else tail = &object;
+    head = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::pushBack(T& object) {
+    link(object);
+    hook(object).prev = tail;
+    if (tail) hook(*tail).next = &object;
+    else head = &object;
+    tail = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::insertBefore(T& pos, T& object) {
+    if (hook(pos).owner != this) {
+        throw std::runtime_error("Position is not linked into this list");
+    }
+    link(object);
+    T* prev = hook(pos).prev;
+    hook(object).prev = prev;
+    hook(object).next = &pos;
+    hook(pos).prev = &object;
+    if (prev) hook(*prev).next = &object;
+    else head = &object;
+    ++size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::remove(T& object) {
+    IntrusiveListHook<T>& h = hook(object);
+    if (h.owner != this) {
+        throw std::runtime_error("Object is not linked into this list");
+    }
+    if (h.prev) hook(*h.prev).next = h.next;
+    else head = h.next;
+    if (h.next) hook(*h.next).prev = h.prev;
+    else tail = h.prev;
+    h.next = h.prev = nullptr;
+    h.owner = nullptr;
+    --size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+T& IntrusiveDoubleList<T, Hook>::popFront() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    T& object = *head;
+    remove(object);
+    return object;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+T& IntrusiveDoubleList<T, Hook>::popBack() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    T& object = *tail;
+    remove(object);
+    return object;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+bool IntrusiveDoubleList<T, Hook>::isLinked(const T& object) {
+    return (object.*Hook).owner != nullptr;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+T& IntrusiveDoubleList<T, Hook>::front() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    return *head;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+T& IntrusiveDoubleList<T, Hook>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return *tail;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+size_t IntrusiveDoubleList<T, Hook>::getSize() const {
+    return size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+bool IntrusiveDoubleList<T, Hook>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::clear() {
+    while (head) {
+        T* next = hook(*head).next;
+        hook(*head).next = hook(*head).prev = nullptr;
+        hook(*head).owner = nullptr;
+        head = next;
+    }
+    tail = nullptr;
+    size = 0;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveDoubleList<T, Hook>::print() const {
+    std::cout << "[";
+    for (const T* current = head; current; current = (current->*Hook).next) {
+        std::cout << *current;
+        if ((current->*Hook).next) std::cout << " <-> ";
+    }
+    std::cout << "]" << std::endl;
+}
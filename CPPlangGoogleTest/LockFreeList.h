@@ -0,0 +1,344 @@
+#pragma once
+#include <iostream>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <utility> // Для std::swap
+
+/**
+ * @brief Упорядоченный неблокирующий односвязный список (алгоритм Harris-Michael).
+ *
+ * Хранит множество уникальных ключей по возрастанию. Операции insert, remove и find
+ * безопасны при одновременном вызове из нескольких потоков и не используют блокировок.
+ *
+ * Удаление выполняется в два шага: сначала узел логически помечается младшим битом
+ * своего поля next, затем физически исключается из цепочки (любым потоком, который
+ * его встретит). Освобождение памяти отложено и защищено указателями опасности
+ * (hazard pointers): узел удаляется только тогда, когда ни один поток его не читает.
+ *
+ * @tparam T Тип ключа. Должен быть копируемым и поддерживать operator< и operator==.
+ * @warning clear(), print() и деструктор нельзя вызывать одновременно с другими операциями.
+ */
+template<typename T>
+class LockFreeList {
+private:
+    struct Node {
+        T key;
+        std::atomic<uintptr_t> next; ///< Указатель на следующий узел; младший бит — метка удаления
+        explicit Node(const T& value) : key(value), next(0) {}
+    };
+    static_assert(alignof(Node) >= 2, "Node alignment must leave the low bit free for the mark");
+
+    static constexpr int HAZARDS_PER_THREAD = 3; ///< Слоты next, curr и prev в search()
+    static constexpr size_t MIN_RETIRE_THRESHOLD = 64;
+
+    /**
+     * @brief Запись указателей опасности. Закрепляется за потоком на время одной операции.
+     */
+    struct HazardRecord {
+        std::atomic<bool> active;
+        std::atomic<Node*> hazards[HAZARDS_PER_THREAD];
+        std::vector<Node*> retired; ///< Узлы, ожидающие освобождения (доступ только владельцу)
+        HazardRecord* next;
+
+        HazardRecord() : active(true), next(nullptr) {
+            for (auto& h : hazards) h.store(nullptr);
+        }
+    };
+
+    std::atomic<uintptr_t> head;
+    std::atomic<size_t> size;
+    std::atomic<HazardRecord*> records;
+    std::atomic<size_t> record_count;
+
+    static Node* pointer(uintptr_t link) { return reinterpret_cast<Node*>(link & ~uintptr_t(1)); }
+    static bool isMarked(uintptr_t link) { return (link & 1) != 0; }
+    static uintptr_t toLink(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+
+    HazardRecord* acquireRecord();
+    void releaseRecord(HazardRecord* record);
+    void retire(HazardRecord* record, Node* node);
+    void scan(HazardRecord* record);
+    bool search(const T& key, HazardRecord* record,
+                std::atomic<uintptr_t>*& prevLink, Node*& curr, Node*& next);
+
+public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой список.
+     */
+    LockFreeList();
+
+    LockFreeList(const LockFreeList&) = delete;
+    LockFreeList& operator=(const LockFreeList&) = delete;
+
+    /**
+     * @brief Деструктор. Освобождает узлы, отложенные узлы и записи указателей опасности.
+     */
+    ~LockFreeList();
+
+    /**
+     * @brief Вставляет ключ, если его еще нет в списке.
+     * Сложность: O(N) в худшем случае, без блокировок.
+     * @param key Вставляемый ключ.
+     * @return true, если ключ вставлен; false, если он уже присутствовал.
+     */
+    bool insert(const T& key);
+
+    /**
+     * @brief Удаляет ключ из списка.
+     * @param key Удаляемый ключ.
+     * @return true, если ключ был найден и удален этим вызовом.
+     */
+    bool remove(const T& key);
+
+    /**
+     * @brief Проверяет наличие ключа.
+     * @param key Искомый ключ.
+     * @return true, если ключ присутствует.
+     */
+    bool find(const T& key);
+
+    /**
+     * @brief Возвращает количество элементов.
+     * При одновременных изменениях значение приблизительное.
+     * @return Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Удаляет все элементы. Не потокобезопасно.
+     */
+    void clear();
+
+    /**
+     * @brief Выводит элементы списка. Не потокобезопасно.
+     */
+    void print() const;
+};
+
+template<typename T>
+LockFreeList<T>::LockFreeList() : head(0), size(0), records(nullptr), record_count(0) {}
+
+template<typename T>
+LockFreeList<T>::~LockFreeList() {
+    clear();
+    HazardRecord* record = records.load();
+    while (record) {
+        HazardRecord* next = record->next;
+        for (Node* node : record->retired) {
+            delete node;
+        }
+        delete record;
+        record = next;
+    }
+}
+
+template<typename T>
+typename LockFreeList<T>::HazardRecord* LockFreeList<T>::acquireRecord() {
+    for (HazardRecord* record = records.load(); record; record = record->next) {
+        bool expected = false;
+        if (!record->active.load(std::memory_order_relaxed) &&
+            record->active.compare_exchange_strong(expected, true)) {
+            return record;
+        }
+    }
+
+    // Свободных записей нет — добавляем новую в начало (записи никогда не удаляются)
+    HazardRecord* record = new HazardRecord();
+    HazardRecord* old_head = records.load();
+    do {
+        record->next = old_head;
+    } while (!records.compare_exchange_weak(old_head, record));
+    record_count.fetch_add(1);
+    return record;
+}
+
+template<typename T>
+void LockFreeList<T>::releaseRecord(HazardRecord* record) {
+    // Устаревший указатель в слоте лишь задерживает освобождение, поэтому достаточно release
+    for (auto& h : record->hazards) {
+        h.store(nullptr, std::memory_order_release);
+    }
+    record->active.store(false, std::memory_order_release);
+}
+
+template<typename T>
+void LockFreeList<T>::retire(HazardRecord* record, Node* node) {
+    record->retired.push_back(node);
+    size_t threshold = std::max(MIN_RETIRE_THRESHOLD, 2 * HAZARDS_PER_THREAD * record_count.load());
+    if (record->retired.size() >= threshold) {
+        scan(record);
+    }
+}
+
+template<typename T>
+void LockFreeList<T>::scan(HazardRecord* record) {
+    // Снимок всех опубликованных указателей опасности
+    std::vector<Node*> protected_nodes;
+    for (HazardRecord* r = records.load(); r; r = r->next) {
+        for (auto& h : r->hazards) {
+            Node* node = h.load();
+            if (node) protected_nodes.push_back(node);
+        }
+    }
+    std::sort(protected_nodes.begin(), protected_nodes.end());
+
+    size_t kept = 0;
+    for (Node* node : record->retired) {
+        if (std::binary_search(protected_nodes.begin(), protected_nodes.end(), node)) {
+            record->retired[kept++] = node;
+        } else {
+            delete node;
+        }
+    }
+    record->retired.resize(kept);
+}
+
+// Находит первый узел с ключом >= key, попутно исключая помеченные узлы.
+// Роли слотов (next, curr, prev) вращаются при продвижении, поэтому на каждый узел
+// приходится одна публикация указателя опасности. По возвращении curr, next и
+// узел-владелец prevLink защищены.
+template<typename T>
+bool LockFreeList<T>::search(const T& key, HazardRecord* record,
+                             std::atomic<uintptr_t>*& prevLink, Node*& curr, Node*& next) {
+retry:
+    int nextSlot = 0, currSlot = 1, prevSlot = 2;
+    prevLink = &head;
+    curr = pointer(head.load());
+    record->hazards[currSlot].store(curr);
+    if (head.load() != toLink(curr)) goto retry;
+
+    while (true) {
+        if (!curr) return false;
+
+        // curr защищен и был достижим, поэтому неизменный непомеченный next тоже в списке
+        uintptr_t nextLink = curr->next.load();
+        next = pointer(nextLink);
+        record->hazards[nextSlot].store(next);
+        if (curr->next.load() != nextLink) goto retry;
+
+        if (isMarked(nextLink)) {
+            // curr логически удален — исключаем его из цепочки
+            uintptr_t expected = toLink(curr);
+            if (!prevLink->compare_exchange_strong(expected, toLink(next))) goto retry;
+            retire(record, curr);
+            curr = next;
+            std::swap(currSlot, nextSlot);
+        } else {
+            if (!(curr->key < key)) {
+                return curr->key == key;
+            }
+            prevLink = &curr->next;
+            curr = next;
+            int freed = prevSlot;
+            prevSlot = currSlot;
+            currSlot = nextSlot;
+            nextSlot = freed;
+        }
+    }
+}
+
+template<typename T>
+bool LockFreeList<T>::insert(const T& key) {
+    HazardRecord* record = acquireRecord();
+    Node* node = new Node(key);
+    std::atomic<uintptr_t>* prevLink;
+    Node* curr;
+    Node* next;
+    while (true) {
+        if (search(key, record, prevLink, curr, next)) {
+            delete node;
+            releaseRecord(record);
+            return false;
+        }
+        node->next.store(toLink(curr));
+        uintptr_t expected = toLink(curr);
+        if (prevLink->compare_exchange_strong(expected, toLink(node))) {
+            size.fetch_add(1);
+            releaseRecord(record);
+            return true;
+        }
+    }
+}
+
+template<typename T>
+bool LockFreeList<T>::remove(const T& key) {
+    HazardRecord* record = acquireRecord();
+    std::atomic<uintptr_t>* prevLink;
+    Node* curr;
+    Node* next;
+    while (true) {
+        if (!search(key, record, prevLink, curr, next)) {
+            releaseRecord(record);
+            return false;
+        }
+        // Логическое удаление: помечаем next у curr
+        uintptr_t nextLink = toLink(next);
+        if (!curr->next.compare_exchange_strong(nextLink, nextLink | 1)) {
+            continue;
+        }
+        size.fetch_sub(1);
+
+        // Физическое удаление; при неудаче узел исключит следующий проход search()
+        uintptr_t expected = toLink(curr);
+        if (prevLink->compare_exchange_strong(expected, toLink(next))) {
+            retire(record, curr);
+        } else {
+            search(key, record, prevLink, curr, next);
+        }
+        releaseRecord(record);
+        return true;
+    }
+}
+
+template<typename T>
+bool LockFreeList<T>::find(const T& key) {
+    HazardRecord* record = acquireRecord();
+    std::atomic<uintptr_t>* prevLink;
+    Node* curr;
+    Node* next;
+    bool found = search(key, record, prevLink, curr, next);
+    releaseRecord(record);
+    return found;
+}
+
+template<typename T>
+size_t LockFreeList<T>::getSize() const {
+    return size.load();
+}
+
+template<typename T>
+bool LockFreeList<T>::isEmpty() const {
+    return size.load() == 0;
+}
+
+template<typename T>
+void LockFreeList<T>::clear() {
+    Node* current = pointer(head.exchange(0));
+    while (current) {
+        Node* next = pointer(current->next.load());
+        delete current;
+        current = next;
+    }
+    size.store(0);
+}
+
+template<typename T>
+void LockFreeList<T>::print() const {
+    std::cout << "[";
+    bool first = true;
+    for (Node* current = pointer(head.load()); current; current = pointer(current->next.load())) {
+        if (isMarked(current->next.load())) continue;
+        if (!first) std::cout << " -> ";
+        std::cout << current->key;
+        first = false;
+    }
+    std::cout << "]" << std::endl;
+}
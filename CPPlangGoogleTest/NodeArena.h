@@ -0,0 +1,147 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility> // Для std::forward, std::swap
+#include "NodePool.h"
+
+/**
+ * @brief Арена узлов одного типа, принадлежащая одному контейнеру.
+ *
+ * Память выделяется крупными блоками (chunk) растущего размера, узлы нарезаются из
+ * текущего блока сдвигом указателя (bump allocation). Узлы, созданные подряд, лежат
+ * в памяти рядом. Освобожденные узлы попадают в список свободных и переиспользуются.
+ * release() возвращает глобальному аллокатору все блоки сразу, без обхода узлов:
+ * деструкторы живых узлов при этом не вызываются, это обязанность контейнера
+ * (для тривиально разрушаемых данных их можно не вызывать вовсе).
+ *
+ * В отличие от NodePool арена не потоково-локальная и не разделяется между контейнерами.
+ *
+ * @tparam Node Тип узла.
+ */
+template<typename Node>
+class NodeArena {
+private:
+    struct alignas(Node) ChunkHeader {
+        ChunkHeader* next;
+    };
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+    static_assert(sizeof(Node) >= sizeof(FreeSlot), "Node is too small for the arena free list");
+    static_assert(alignof(Node) <= alignof(std::max_align_t), "Over-aligned nodes are not supported");
+
+    static constexpr size_t FIRST_CHUNK_NODES = 32;
+    static constexpr size_t MAX_CHUNK_NODES = 16384;
+
+    ChunkHeader* chunks;   ///< Список выделенных блоков (последний выделенный — первый)
+    Node* cursor;          ///< Следующий свободный узел в текущем блоке
+    Node* limit;           ///< Конец текущего блока
+    size_t nextChunkNodes; ///< Вместимость следующего блока
+    size_t chunkCount;
+    FreeSlot* freeList;
+
+    void addChunk() {
+        void* memory = ::operator new(sizeof(ChunkHeader) + nextChunkNodes * sizeof(Node));
+        NodeAllocStats::countAllocation();
+        ChunkHeader* chunk = static_cast<ChunkHeader*>(memory);
+        chunk->next = chunks;
+        chunks = chunk;
+        cursor = reinterpret_cast<Node*>(chunk + 1);
+        limit = cursor + nextChunkNodes;
+        ++chunkCount;
+        if (nextChunkNodes < MAX_CHUNK_NODES) {
+            nextChunkNodes *= 2;
+        }
+    }
+
+public:
+    NodeArena()
+        : chunks(nullptr), cursor(nullptr), limit(nullptr),
+          nextChunkNodes(FIRST_CHUNK_NODES), chunkCount(0), freeList(nullptr) {}
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /**
+     * @brief Деструктор. Освобождает все блоки (см. release()).
+     */
+    ~NodeArena() {
+        release();
+    }
+
+    /**
+     * @brief Создает узел в памяти арены.
+     * @param args Аргументы конструктора узла.
+     * @return Указатель на созданный узел.
+     */
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        void* memory;
+        if (freeList) {
+            memory = freeList;
+            freeList = freeList->next;
+        } else {
+            if (cursor == limit) {
+                addChunk();
+            }
+            memory = cursor++;
+        }
+        try {
+            return new (memory) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            FreeSlot* slot = static_cast<FreeSlot*>(memory);
+            slot->next = freeList;
+            freeList = slot;
+            throw;
+        }
+    }
+
+    /**
+     * @brief Разрушает узел и возвращает его память в список свободных.
+     * @param node Узел, созданный этой ареной.
+     */
+    void destroy(Node* node) {
+        node->~Node();
+        FreeSlot* slot = reinterpret_cast<FreeSlot*>(node);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    /**
+     * @brief Освобождает все блоки арены. Сложность: O(число блоков).
+     * @warning Деструкторы узлов не вызываются; все узлы арены становятся недействительными.
+     */
+    void release() {
+        while (chunks) {
+            ChunkHeader* next = chunks->next;
+            ::operator delete(chunks);
+            NodeAllocStats::countDeallocation();
+            chunks = next;
+        }
+        cursor = limit = nullptr;
+        nextChunkNodes = FIRST_CHUNK_NODES;
+        chunkCount = 0;
+        freeList = nullptr;
+    }
+
+    /**
+     * @brief Обменивается содержимым с другой ареной за O(1).
+     * @param other Другая арена.
+     */
+    void swap(NodeArena& other) {
+        std::swap(chunks, other.chunks);
+        std::swap(cursor, other.cursor);
+        std::swap(limit, other.limit);
+        std::swap(nextChunkNodes, other.nextChunkNodes);
+        std::swap(chunkCount, other.chunkCount);
+        std::swap(freeList, other.freeList);
+    }
+
+    /**
+     * @brief Возвращает количество выделенных блоков.
+     * @return Число блоков.
+     */
+    size_t getChunkCount() const {
+        return chunkCount;
+    }
+};
@@ -0,0 +1,286 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility> // Для std::forward
+
+/**
+ * @brief Счетчики обращений узловых контейнеров к глобальному аллокатору.
+ *
+ * Учитываются только вызовы ::operator new / ::operator delete, выполненные
+ * политиками выделения узлов. Счетчики локальны для потока и обновляются только
+ * при сборке с макросом NODE_ALLOC_STATS, иначе подсчет не стоит ничего.
+ */
+struct NodeAllocStats {
+    /**
+     * @brief Количество выделений памяти у глобального аллокатора.
+     * @return Ссылка на счетчик текущего потока.
+     */
+    static size_t& allocations() {
+        static thread_local size_t count = 0;
+        return count;
+    }
+
+    /**
+     * @brief Количество освобождений памяти через глобальный аллокатор.
+     * @return Ссылка на счетчик текущего потока.
+     */
+    static size_t& deallocations() {
+        static thread_local size_t count = 0;
+        return count;
+    }
+
+    /**
+     * @brief Обнуляет оба счетчика текущего потока.
+     */
+    static void reset() {
+        allocations() = 0;
+        deallocations() = 0;
+    }
+
+    /**
+     * @brief Учитывает одно выделение (только при NODE_ALLOC_STATS).
+     */
+    static void countAllocation() {
+#ifdef NODE_ALLOC_STATS
+        ++allocations();
+#endif
+    }
+
+    /**
+     * @brief Учитывает одно освобождение (только при NODE_ALLOC_STATS).
+     */
+    static void countDeallocation() {
+#ifdef NODE_ALLOC_STATS
+        ++deallocations();
+#endif
+    }
+};
+
+/**
+ * @brief Потоково-локальный пул освобожденных узлов одного типа.
+ *
+ * Хранит освобожденные блоки памяти в односвязном списке (free list) и отдает их
+ * при следующем выделении. Количество закешированных блоков ограничено MaxCached,
+ * лишние блоки возвращаются глобальному аллокатору.
+ *
+ * Операции статические: пока поток завершается и его пул уже разрушен,
+ * они работают напрямую с глобальным аллокатором, не обращаясь к объекту пула.
+ *
+ * @tparam Node Тип узла. Пул привязан к типу, поэтому блоки разных размеров не смешиваются.
+ * @tparam MaxCached Максимальное количество блоков в кеше одного потока.
+ */
+template<typename Node, size_t MaxCached>
+class NodePool {
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+    static_assert(sizeof(Node) >= sizeof(FreeSlot), "Node is too small to be pooled");
+    static_assert(alignof(Node) <= alignof(std::max_align_t), "Over-aligned nodes are not supported");
+
+    FreeSlot* head;
+    size_t cached;
+
+    NodePool() : head(nullptr), cached(0) {}
+
+    /**
+     * @brief Пул текущего потока.
+     * @warning Нельзя вызывать после destroyed() == true: объект уже разрушен.
+     */
+    static NodePool& local() {
+        static thread_local NodePool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Признак того, что пул текущего потока уже разрушен.
+     * Тривиально разрушаемая переменная остается доступной до конца потока.
+     */
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    static void freeBlock(void* memory) {
+        NodeAllocStats::countDeallocation();
+        ::operator delete(memory);
+    }
+
+public:
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Деструктор. Возвращает все закешированные блоки глобальному аллокатору.
+     */
+    ~NodePool() {
+        while (head) {
+            FreeSlot* temp = head;
+            head = head->next;
+            freeBlock(temp);
+        }
+        cached = 0;
+        destroyed() = true;
+    }
+
+    /**
+     * @brief Выдает неинициализированный блок памяти под один узел.
+     * @return Указатель на блок размера sizeof(Node).
+     */
+    static void* acquire() {
+        if (!destroyed()) {
+            NodePool& pool = local();
+            if (pool.head) {
+                FreeSlot* slot = pool.head;
+                pool.head = slot->next;
+                --pool.cached;
+                return slot;
+            }
+        }
+        NodeAllocStats::countAllocation();
+        return ::operator new(sizeof(Node));
+    }
+
+    /**
+     * @brief Принимает блок обратно в кеш или освобождает его при переполнении кеша.
+     * @param memory Блок, ранее полученный через acquire().
+     */
+    static void release(void* memory) {
+        if (!destroyed()) {
+            NodePool& pool = local();
+            if (pool.cached < MaxCached) {
+                FreeSlot* slot = static_cast<FreeSlot*>(memory);
+                slot->next = pool.head;
+                pool.head = slot;
+                ++pool.cached;
+                return;
+            }
+        }
+        freeBlock(memory);
+    }
+
+    /**
+     * @brief Принимает цепочку блоков count штук одним вызовом.
+     * Проверка кеша и обращение к потоково-локальному пулу выполняются один раз на пакет.
+     * @param first Первый блок цепочки, связанной через FreeSlot::next (см. prepareSlot()).
+     * @param last Последний блок цепочки.
+     * @param count Количество блоков в цепочке.
+     */
+    static void releaseChain(void* first, void* last, size_t count) {
+        if (!destroyed()) {
+            NodePool& pool = local();
+            if (pool.cached + count <= MaxCached) {
+                static_cast<FreeSlot*>(last)->next = pool.head;
+                pool.head = static_cast<FreeSlot*>(first);
+                pool.cached += count;
+                return;
+            }
+        }
+        FreeSlot* slot = static_cast<FreeSlot*>(first);
+        while (count-- > 0) {
+            FreeSlot* next = slot->next;
+            release(slot);
+            slot = next;
+        }
+    }
+
+    /**
+     * @brief Записывает ссылку на следующий блок в освобожденную память узла.
+     * @param memory Освобожденный блок (деструктор узла уже вызван).
+     * @param next Следующий блок цепочки или nullptr.
+     */
+    static void prepareSlot(void* memory, void* next) {
+        static_cast<FreeSlot*>(memory)->next = static_cast<FreeSlot*>(next);
+    }
+
+    /**
+     * @brief Возвращает количество блоков в кеше текущего потока.
+     * @return Число закешированных блоков.
+     */
+    static size_t getCachedCount() {
+        return destroyed() ? 0 : local().cached;
+    }
+};
+
+/**
+ * @brief Политика выделения узлов по умолчанию: каждый узел через new/delete.
+ */
+struct DefaultNodeAllocator {
+    template<typename Node, typename... Args>
+    static Node* create(Args&&... args) {
+        NodeAllocStats::countAllocation();
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    template<typename Node>
+    static void destroy(Node* node) {
+        NodeAllocStats::countDeallocation();
+        delete node;
+    }
+
+    /**
+     * @brief Освобождает цепочку узлов, связанных через поле next.
+     * @param first Первый узел цепочки (nullptr-терминированной).
+     */
+    template<typename Node>
+    static void destroyChain(Node* first) {
+        while (first) {
+            Node* next = first->next;
+            destroy(first);
+            first = next;
+        }
+    }
+};
+
+/**
+ * @brief Политика выделения узлов через потоково-локальный NodePool.
+ *
+ * При постоянном размере контейнера (например, enqueue + dequeue) узлы
+ * переиспользуются, и обращения к глобальному аллокатору прекращаются.
+ *
+ * @tparam MaxCached Максимальное количество кешируемых узлов на поток и тип узла.
+ */
+template<size_t MaxCached = 1024>
+struct PooledNodeAllocator {
+    template<typename Node, typename... Args>
+    static Node* create(Args&&... args) {
+        using Pool = NodePool<Node, MaxCached>;
+        void* memory = Pool::acquire();
+        try {
+            return new (memory) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            Pool::release(memory);
+            throw;
+        }
+    }
+
+    template<typename Node>
+    static void destroy(Node* node) {
+        node->~Node();
+        NodePool<Node, MaxCached>::release(node);
+    }
+
+    /**
+     * @brief Освобождает цепочку узлов, связанных через поле next, одним пакетом.
+     * Блоки сразу перевязываются в список свободных и передаются пулу целиком.
+     * @param first Первый узел цепочки (nullptr-терминированной).
+     */
+    template<typename Node>
+    static void destroyChain(Node* first) {
+        using Pool = NodePool<Node, MaxCached>;
+        void* chainHead = first;
+        void* chainTail = nullptr;
+        size_t count = 0;
+        while (first) {
+            Node* next = first->next;
+            first->~Node();
+            Pool::prepareSlot(first, next);
+            chainTail = first;
+            first = next;
+            ++count;
+        }
+        if (count > 0) {
+            Pool::releaseChain(chainHead, chainTail, count);
+        }
+    }
+};
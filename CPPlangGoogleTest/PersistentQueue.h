@@ -0,0 +1,428 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <string>   // Явно включено для поддержки std::string
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <cstdio>   // Для std::rename, std::remove
+#include <cstring>
+#include <charconv>
+#include <filesystem>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Персистентная очередь на основе журнала отображаемых в память сегментов.
+ *
+ * Элементы дописываются в файлы-сегменты фиксированной ёмкости, отображённые через mmap.
+ * Позиции чтения и записи хранятся в отдельном отображённом файле метаданных в виде
+ * монотонных счетчиков, поэтому каждая операция обновляет одно 8-байтовое поле,
+ * а "контрольная точка" не требует повторной сериализации всей очереди (O(1) вместо O(N)).
+ * Полностью прочитанные сегменты не удаляются, а переиспользуются для новых записей.
+ *
+ * Содержимое переживает перезапуск процесса: при открытии каталога сегменты
+ * отображаются заново, без повторной вставки элементов.
+ *
+ * @tparam T Тип хранимых данных. Должен быть тривиально копируемым (POD).
+ * @warning Только для POSIX-систем. Один каталог может открывать только один объект.
+ */
+template<typename T>
+class PersistentQueue {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "PersistentQueue requires a trivially copyable type");
+
+private:
+    /// Заголовок файла метаданных.
+    struct Meta {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t segment_capacity;
+        uint64_t read_pos;  ///< Абсолютная позиция следующего элемента для чтения
+        uint64_t write_pos; ///< Абсолютная позиция следующего элемента для записи
+    };
+
+    /// Отображённый в память сегмент журнала.
+    struct Segment {
+        uint64_t id;
+        T* data;
+    };
+
+    static constexpr uint64_t MAGIC = 0x5051554555455347ULL; // "PQUEUESG"
+    static constexpr size_t MAX_SPARE_SEGMENTS = 2;
+
+    std::string directory;
+    size_t segment_capacity;  ///< Количество элементов в одном сегменте
+    int meta_fd;
+    Meta* meta;
+    std::deque<Segment> segments;        ///< Отображённые сегменты от головы к хвосту
+    std::vector<std::string> spare_files; ///< Прочитанные сегменты, готовые к повторному использованию
+
+    std::string segmentPath(uint64_t id) const;
+    std::string sparePath(uint64_t id) const;
+    size_t segmentBytes() const;
+    T* mapFile(int fd) const;
+    void mapSegment(uint64_t id);
+    void retireFront();
+    void releaseConsumed();
+    T* slotForWrite();
+    void openDirectory();
+    void scanDirectory();
+    void unmapAll();
+
+public:
+    /**
+     * @brief Открывает (или создаёт) очередь в указанном каталоге.
+     * Если каталог уже содержит очередь, её состояние восстанавливается.
+     * @param dir Путь к каталогу с файлами очереди.
+     * @param capacity Количество элементов в одном сегменте.
+     * @throw std::runtime_error При ошибке ввода-вывода или несовместимых метаданных.
+     */
+    explicit PersistentQueue(const std::string& dir, size_t capacity = 4096);
+
+    PersistentQueue(const PersistentQueue&) = delete;
+    PersistentQueue& operator=(const PersistentQueue&) = delete;
+
+    /**
+     * @brief Деструктор. Снимает отображения и закрывает файлы.
+     * Данные остаются на диске.
+     */
+    ~PersistentQueue();
+
+    /**
+     * @brief Добавляет элемент в конец очереди.
+     * Сложность: O(1) (амортизированно, с учетом создания нового сегмента).
+     * @param element Значение для вставки.
+     */
+    void enqueue(const T& element);
+
+    /**
+     * @brief Удаляет элемент из начала очереди.
+     * Сложность: O(1). Полностью прочитанный сегмент отправляется на переиспользование.
+     * @throw std::runtime_error Если очередь пуста.
+     */
+    void dequeue();
+
+    /**
+     * @brief Возвращает первый элемент очереди.
+     * @return Константная ссылка на элемент в голове.
+     * @throw std::runtime_error Если очередь пуста.
+     */
+    const T& front() const;
+
+    /**
+     * @brief Возвращает последний элемент очереди.
+     * @return Константная ссылка на элемент в хвосте.
+     * @throw std::runtime_error Если очередь пуста.
+     */
+    const T& back() const;
+
+    /**
+     * @brief Возвращает текущий размер очереди.
+     * @return Количество элементов.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуста ли очередь.
+     * @return true, если элементов нет, иначе false.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Очищает очередь за O(1), сдвигая позицию чтения к позиции записи.
+     */
+    void clear();
+
+    /**
+     * @brief Контрольная точка: сбрасывает отображённые страницы на диск (msync).
+     * Стоимость пропорциональна объёму изменённых с прошлого вызова данных,
+     * а не размеру очереди. Для устойчивости к падению процесса вызов не требуется.
+     */
+    void sync();
+
+    /**
+     * @brief Возвращает количество сегментов, отображённых в память.
+     * @return Число сегментов.
+     */
+    size_t getSegmentCount() const;
+
+    /**
+     * @brief Выводит содержимое очереди в консоль от начала к концу.
+     */
+    void print() const;
+};
+
+template<typename T>
+PersistentQueue<T>::PersistentQueue(const std::string& dir, size_t capacity)
+    : directory(dir), segment_capacity(capacity), meta_fd(-1), meta(nullptr) {
+    if (segment_capacity == 0) {
+        throw std::runtime_error("Segment capacity must be positive");
+    }
+    openDirectory();
+}
+
+template<typename T>
+PersistentQueue<T>::~PersistentQueue() {
+    unmapAll();
+}
+
+template<typename T>
+void PersistentQueue<T>::unmapAll() {
+    for (const Segment& segment : segments) {
+        munmap(segment.data, segmentBytes());
+    }
+    segments.clear();
+    if (meta) munmap(meta, sizeof(Meta));
+    if (meta_fd >= 0) close(meta_fd);
+    meta = nullptr;
+    meta_fd = -1;
+}
+
+template<typename T>
+std::string PersistentQueue<T>::segmentPath(uint64_t id) const {
+    return directory + "/" + std::to_string(id) + ".seg";
+}
+
+template<typename T>
+std::string PersistentQueue<T>::sparePath(uint64_t id) const {
+    return directory + "/" + std::to_string(id) + ".spare";
+}
+
+template<typename T>
+size_t PersistentQueue<T>::segmentBytes() const {
+    return segment_capacity * sizeof(T);
+}
+
+template<typename T>
+T* PersistentQueue<T>::mapFile(int fd) const {
+    void* addr = mmap(nullptr, segmentBytes(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        throw std::runtime_error("Failed to map queue segment");
+    }
+    return static_cast<T*>(addr);
+}
+
+template<typename T>
+void PersistentQueue<T>::mapSegment(uint64_t id) {
+    std::string path = segmentPath(id);
+
+    // Новый сегмент берем из запаса прочитанных, чтобы не создавать файл заново
+    if (access(path.c_str(), F_OK) != 0 && !spare_files.empty()) {
+        if (std::rename(spare_files.back().c_str(), path.c_str()) == 0) {
+            spare_files.pop_back();
+        }
+    }
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open queue segment: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (static_cast<size_t>(st.st_size) < segmentBytes() &&
+                                ftruncate(fd, static_cast<off_t>(segmentBytes())) != 0)) {
+        close(fd);
+        throw std::runtime_error("Failed to resize queue segment: " + path);
+    }
+
+    T* data;
+    try {
+        data = mapFile(fd);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    close(fd); // Отображение остаётся действительным и после закрытия дескриптора
+    segments.push_back({id, data});
+}
+
+template<typename T>
+void PersistentQueue<T>::retireFront() {
+    Segment segment = segments.front();
+    segments.pop_front();
+    munmap(segment.data, segmentBytes());
+
+    std::string path = segmentPath(segment.id);
+    if (spare_files.size() < MAX_SPARE_SEGMENTS) {
+        std::string spare = sparePath(segment.id);
+        if (std::rename(path.c_str(), spare.c_str()) == 0) {
+            spare_files.push_back(spare);
+            return;
+        }
+    }
+    std::remove(path.c_str());
+}
+
+template<typename T>
+void PersistentQueue<T>::releaseConsumed() {
+    uint64_t head_id = meta->read_pos / segment_capacity;
+    while (!segments.empty() && segments.front().id < head_id) {
+        retireFront();
+    }
+}
+
+template<typename T>
+T* PersistentQueue<T>::slotForWrite() {
+    uint64_t id = meta->write_pos / segment_capacity;
+    if (segments.empty() || segments.back().id != id) {
+        mapSegment(id);
+    }
+    return segments.back().data + meta->write_pos % segment_capacity;
+}
+
+template<typename T>
+void PersistentQueue<T>::openDirectory() {
+    std::filesystem::create_directories(directory);
+
+    std::string meta_path = directory + "/queue.meta";
+    meta_fd = open(meta_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (meta_fd < 0) {
+        throw std::runtime_error("Failed to open queue metadata: " + meta_path);
+    }
+    struct stat st;
+    if (fstat(meta_fd, &st) != 0) {
+        close(meta_fd);
+        throw std::runtime_error("Failed to stat queue metadata: " + meta_path);
+    }
+    bool fresh = static_cast<size_t>(st.st_size) < sizeof(Meta);
+    if (fresh && ftruncate(meta_fd, sizeof(Meta)) != 0) {
+        close(meta_fd);
+        throw std::runtime_error("Failed to resize queue metadata: " + meta_path);
+    }
+    void* addr = mmap(nullptr, sizeof(Meta), PROT_READ | PROT_WRITE, MAP_SHARED, meta_fd, 0);
+    if (addr == MAP_FAILED) {
+        close(meta_fd);
+        throw std::runtime_error("Failed to map queue metadata: " + meta_path);
+    }
+    meta = static_cast<Meta*>(addr);
+
+    if (fresh) {
+        meta->element_size = sizeof(T);
+        meta->segment_capacity = segment_capacity;
+        meta->read_pos = 0;
+        meta->write_pos = 0;
+        meta->magic = MAGIC;
+    } else if (meta->magic != MAGIC || meta->element_size != sizeof(T) ||
+               meta->segment_capacity != segment_capacity) {
+        unmapAll();
+        throw std::runtime_error("Queue metadata does not match element type or segment capacity");
+    }
+
+    // Деструктор не вызывается, если конструктор завершился исключением,
+    // поэтому отображения освобождаются здесь
+    try {
+        scanDirectory();
+    } catch (...) {
+        unmapAll();
+        throw;
+    }
+}
+
+// Удаляет устаревшие файлы и отображает сегменты с непрочитанными данными.
+// Файлы с нечисловыми именами не принадлежат очереди и пропускаются.
+template<typename T>
+void PersistentQueue<T>::scanDirectory() {
+    // Сегменты вне диапазона [read_pos, write_pos) остались от прочитанных данных
+    uint64_t first = meta->read_pos / segment_capacity;
+    uint64_t last = meta->write_pos == meta->read_pos ? first : (meta->write_pos - 1) / segment_capacity;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        std::string ext = entry.path().extension().string();
+        if (ext == ".spare") {
+            if (spare_files.size() < MAX_SPARE_SEGMENTS) spare_files.push_back(entry.path().string());
+            else std::filesystem::remove(entry.path());
+        } else if (ext == ".seg") {
+            std::string stem = entry.path().stem().string();
+            uint64_t id = 0;
+            auto [end, error] = std::from_chars(stem.data(), stem.data() + stem.size(), id);
+            if (error != std::errc() || end != stem.data() + stem.size()) {
+                continue;
+            }
+            if (id < first || id > last) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    if (meta->write_pos != meta->read_pos) {
+        for (uint64_t id = first; id <= last; ++id) {
+            mapSegment(id);
+        }
+    }
+}
+
+template<typename T>
+void PersistentQueue<T>::enqueue(const T& element) {
+    T* slot = slotForWrite();
+    std::memcpy(slot, &element, sizeof(T));
+    // Позиция публикуется после записи данных: одно 8-байтовое обновление
+    ++meta->write_pos;
+}
+
+template<typename T>
+void PersistentQueue<T>::dequeue() {
+    if (isEmpty()) {
+        throw std::runtime_error("Queue is empty");
+    }
+    ++meta->read_pos;
+    releaseConsumed();
+}
+
+template<typename T>
+const T& PersistentQueue<T>::front() const {
+    if (isEmpty()) {
+        throw std::runtime_error("Queue is empty");
+    }
+    return segments.front().data[meta->read_pos % segment_capacity];
+}
+
+template<typename T>
+const T& PersistentQueue<T>::back() const {
+    if (isEmpty()) {
+        throw std::runtime_error("Queue is empty");
+    }
+    uint64_t last = meta->write_pos - 1;
+    return segments.back().data[last % segment_capacity];
+}
+
+template<typename T>
+size_t PersistentQueue<T>::getSize() const {
+    return static_cast<size_t>(meta->write_pos - meta->read_pos);
+}
+
+template<typename T>
+bool PersistentQueue<T>::isEmpty() const {
+    return meta->write_pos == meta->read_pos;
+}
+
+template<typename T>
+void PersistentQueue<T>::clear() {
+    meta->read_pos = meta->write_pos;
+    releaseConsumed();
+}
+
+template<typename T>
+void PersistentQueue<T>::sync() {
+    for (const Segment& segment : segments) {
+        msync(segment.data, segmentBytes(), MS_SYNC);
+    }
+    msync(meta, sizeof(Meta), MS_SYNC);
+}
+
+template<typename T>
+size_t PersistentQueue<T>::getSegmentCount() const {
+    return segments.size();
+}
+
+template<typename T>
+void PersistentQueue<T>::print() const {
+    std::cout << "Front -> [";
+    for (uint64_t pos = meta->read_pos; pos < meta->write_pos; ++pos) {
+        const Segment& segment = segments[pos / segment_capacity - segments.front().id];
+        std::cout << segment.data[pos % segment_capacity];
+        if (pos + 1 < meta->write_pos) std::cout << ", ";
+    }
+    std::cout << "] <- Back" << std::endl;
+}
@@ -2,7 +2,8 @@
 #include <iostream>
 #include <stdexcept>
 #include <string>  // Явно включено для поддержки std::string
-#include <utility> // Для std::swap
+#include <utility> // Для std::swap, std::move, std::forward
+#include "NodePool.h"
 
 /**
  * @brief Шаблонный класс Очереди (Queue).
@@ -11,16 +12,21 @@
  * Элементы добавляются в "хвост" (back) и извлекаются из "головы" (front).
  *
  * @tparam T Тип хранимых данных.
+ * @tparam Alloc Политика выделения узлов: DefaultNodeAllocator (new/delete)
+ *               или PooledNodeAllocator<> (переиспользование узлов через NodePool).
  */
-template<typename T>
+template<typename T, typename Alloc = DefaultNodeAllocator>
 class Queue {
 private:
     struct Node {
         T data;
         Node* next;
-        Node(const T& value) : data(value), next(nullptr) {}
+        template<typename... Args>
+        explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr) {}
     };
 
+    void linkBack(Node* newNode);
+
     Node* front_node; ///< Указатель на начало очереди (отсюда забираем)
     Node* back_node;  ///< Указатель на конец очереди (сюда добавляем)
     size_t size;
@@ -46,6 +52,20 @@ public:
      */
     Queue& operator=(const Queue& other);
 
+    /**
+     * @brief Конструктор перемещения.
+     * Забирает узлы другой очереди без копирования элементов.
+     * @param other Очередь-источник (остается пустой).
+     */
+    Queue(Queue&& other) noexcept;
+
+    /**
+     * @brief Оператор перемещающего присваивания.
+     * @param other Очередь-источник (получает старое содержимое текущей).
+     * @return Ссылка на текущий объект.
+     */
+    Queue& operator=(Queue&& other) noexcept;
+
     /**
      * @brief Деструктор. Освобождает память всех узлов.
      */
@@ -57,12 +77,52 @@ public:
      */
     void enqueue(const T& element);
 
+    /**
+     * @brief Добавляет элемент в конец очереди, перемещая его (без копирования).
+     * @param element Значение для вставки.
+     */
+    void enqueue(T&& element);
+
+    /**
+     * @brief Конструирует элемент прямо в узле в конце очереди.
+     * @param args Аргументы конструктора T.
+     * @return Ссылка на созданный элемент.
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * @brief Добавляет в конец очереди все элементы диапазона [first, last).
+     * Узлы связываются в локальную цепочку и присоединяются к хвосту одной операцией.
+     * @param first Начало диапазона.
+     * @param last Конец диапазона.
+     */
+    template<typename InputIt>
+    void enqueueRange(InputIt first, InputIt last);
+
     /**
      * @brief Удаляет элемент из начала очереди (dequeue).
      * @throw std::runtime_error Если очередь пуста.
      */
     void dequeue();
 
+    /**
+     * @brief Извлекает первый элемент, перемещая его в out.
+     * Заменяет пару вызовов front() + dequeue() без лишнего копирования.
+     * @param out Приемник значения.
+     * @return true, если элемент извлечен; false, если очередь пуста.
+     */
+    bool tryPop(T& out);
+
+    /**
+     * @brief Извлекает до n элементов из начала очереди, перемещая их в out.
+     * @param out Итератор вывода (например, указатель на буфер или back_inserter).
+     * @param n Максимальное количество извлекаемых элементов.
+     * @return Количество извлеченных элементов.
+     */
+    template<typename OutputIt>
+    size_t dequeueInto(OutputIt out, size_t n);
+
     /**
      * @brief Возвращает ссылку на первый элемент очереди.
      * @return Ссылка на элемент в голове (front).
@@ -158,11 +218,11 @@ public:
     void deserializeText(std::istream& in);
 };
 
-template<typename T>
-Queue<T>::Queue() : front_node(nullptr), back_node(nullptr), size(0) {}
+template<typename T, typename Alloc>
+Queue<T, Alloc>::Queue() : front_node(nullptr), back_node(nullptr), size(0) {}
 
-template<typename T>
-Queue<T>::Queue(const Queue& other) : front_node(nullptr), back_node(nullptr), size(0) {
+template<typename T, typename Alloc>
+Queue<T, Alloc>::Queue(const Queue& other) : front_node(nullptr), back_node(nullptr), size(0) {
     Node* current = other.front_node;
     while (current) {
         enqueue(current->data);
@@ -170,12 +230,12 @@ Queue<T>::Queue(const Queue& other) : front_node(nullptr), back_node(nullptr), s
     }
 }
 
-template<typename T>
-Queue<T>& Queue<T>::operator=(const Queue& other) {
+template<typename T, typename Alloc>
+Queue<T, Alloc>& Queue<T, Alloc>::operator=(const Queue& other) {
     if (this != &other) {
         // Использование идиомы Copy-and-Swap.
         // 1. Создаем временную копию. Если вылетит исключение, 'this' не пострадает.
-        Queue<T> temp(other);
+        Queue temp(other);
         
         // 2. Меняем внутреннее состояние текущего объекта и временного.
         std::swap(front_node, temp.front_node);
@@ -187,14 +247,30 @@ Queue<T>& Queue<T>::operator=(const Queue& other) {
     return *this;
 }
 
-template<typename T>
-Queue<T>::~Queue() {
+template<typename T, typename Alloc>
+Queue<T, Alloc>::Queue(Queue&& other) noexcept
+    : front_node(other.front_node), back_node(other.back_node), size(other.size) {
+    other.front_node = other.back_node = nullptr;
+    other.size = 0;
+}
+
+template<typename T, typename Alloc>
+Queue<T, Alloc>& Queue<T, Alloc>::operator=(Queue&& other) noexcept {
+    if (this != &other) {
+        std::swap(front_node, other.front_node);
+        std::swap(back_node, other.back_node);
+        std::swap(size, other.size);
+    }
+    return *this;
+}
+
+template<typename T, typename Alloc>
+Queue<T, Alloc>::~Queue() {
     clear();
 }
 
-template<typename T>
-void Queue<T>::enqueue(const T& element) {
-    Node* newNode = new Node(element);
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::linkBack(Node* newNode) {
     if (!back_node) {
         front_node = back_node = newNode;
     } else {
@@ -204,8 +280,58 @@ void Queue<T>::enqueue(const T& element) {
     ++size;
 }
 
-template<typename T>
-void Queue<T>::dequeue() {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::enqueue(const T& element) {
+    linkBack(Alloc::template create<Node>(element));
+}
+
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::enqueue(T&& element) {
+    linkBack(Alloc::template create<Node>(std::move(element)));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& Queue<T, Alloc>::emplace(Args&&... args) {
+    linkBack(Alloc::template create<Node>(std::forward<Args>(args)...));
+    return back_node->data;
+}
+
+template<typename T, typename Alloc>
+template<typename InputIt>
+void Queue<T, Alloc>::enqueueRange(InputIt first, InputIt last) {
+    if (first == last) return;
+
+    // Собираем локальную цепочку: при исключении очередь не изменится
+    Node* chainHead = Alloc::template create<Node>(*first);
+    Node* chainTail = chainHead;
+    size_t count = 1;
+    try {
+        for (++first; first != last; ++first) {
+            chainTail->next = Alloc::template create<Node>(*first);
+            chainTail = chainTail->next;
+            ++count;
+        }
+    } catch (...) {
+        while (chainHead) {
+            Node* temp = chainHead;
+            chainHead = chainHead->next;
+            Alloc::destroy(temp);
+        }
+        throw;
+    }
+
+    if (!back_node) {
+        front_node = chainHead;
+    } else {
+        back_node->next = chainHead;
+    }
+    back_node = chainTail;
+    size += count;
+}
+
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::dequeue() {
     if (!front_node) {
         throw std::runtime_error("Queue is empty");
     }
@@ -214,65 +340,94 @@ void Queue<T>::dequeue() {
     if (!front_node) {
         back_node = nullptr;
     }
-    delete temp;
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-T& Queue<T>::front() {
+template<typename T, typename Alloc>
+bool Queue<T, Alloc>::tryPop(T& out) {
+    if (!front_node) {
+        return false;
+    }
+    out = std::move(front_node->data);
+    dequeue();
+    return true;
+}
+
+template<typename T, typename Alloc>
+template<typename OutputIt>
+size_t Queue<T, Alloc>::dequeueInto(OutputIt out, size_t n) {
+    size_t count = 0;
+    while (count < n && front_node) {
+        Node* temp = front_node;
+        *out = std::move(temp->data);
+        ++out;
+        front_node = temp->next;
+        Alloc::destroy(temp);
+        --size;
+        ++count;
+    }
+    if (!front_node) {
+        back_node = nullptr;
+    }
+    return count;
+}
+
+template<typename T, typename Alloc>
+T& Queue<T, Alloc>::front() {
     if (!front_node) {
         throw std::runtime_error("Queue is empty");
     }
     return front_node->data;
 }
 
-template<typename T>
-const T& Queue<T>::front() const {
+template<typename T, typename Alloc>
+const T& Queue<T, Alloc>::front() const {
     if (!front_node) {
         throw std::runtime_error("Queue is empty");
     }
     return front_node->data;
 }
 
-template<typename T>
-T& Queue<T>::back() {
+template<typename T, typename Alloc>
+T& Queue<T, Alloc>::back() {
     if (!back_node) {
         throw std::runtime_error("Queue is empty");
     }
     return back_node->data;
 }
 
-template<typename T>
-const T& Queue<T>::back() const {
+template<typename T, typename Alloc>
+const T& Queue<T, Alloc>::back() const {
     if (!back_node) {
         throw std::runtime_error("Queue is empty");
     }
     return back_node->data;
 }
 
-template<typename T>
-size_t Queue<T>::getSize() const {
+template<typename T, typename Alloc>
+size_t Queue<T, Alloc>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool Queue<T>::isEmpty() const {
+template<typename T, typename Alloc>
+bool Queue<T, Alloc>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void Queue<T>::clear() {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::clear() {
     while (front_node) {
         Node* temp = front_node;
         front_node = front_node->next;
-        delete temp;
+        Alloc::destroy(temp);
     }
     back_node = nullptr;
     size = 0;
 }
 
-template<typename T>
-void Queue<T>::print() const {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::print() const {
     std::cout << "Front -> [";
     Node* current = front_node;
     while (current) {
@@ -283,19 +438,19 @@ void Queue<T>::print() const {
     std::cout << "] <- Back" << std::endl;
 }
 
-template<typename T>
-void Queue<T>::serialize(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::serialize(std::ostream& out) const {
     serializeBinary(out);
 }
 
-template<typename T>
-void Queue<T>::deserialize(std::istream& in) {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::deserialize(std::istream& in) {
     deserializeBinary(in);
 }
 
 // Важно: бинарная сериализация корректна только для тривиально копируемых типов
-template<typename T>
-void Queue<T>::serializeBinary(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::serializeBinary(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&size), sizeof(size));
     Node* current = front_node;
     while (current) {
@@ -305,8 +460,8 @@ void Queue<T>::serializeBinary(std::ostream& out) const {
 }
 
 // Важно: бинарная десериализация корректна только для тривиально копируемых типов
-template<typename T>
-void Queue<T>::deserializeBinary(std::istream& in) {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::deserializeBinary(std::istream& in) {
     clear();
     size_t new_size;
     in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
@@ -317,8 +472,8 @@ void Queue<T>::deserializeBinary(std::istream& in) {
     }
 }
 
-template<typename T>
-void Queue<T>::serializeText(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::serializeText(std::ostream& out) const {
     out << size << std::endl;
     Node* current = front_node;
     while (current) {
@@ -329,8 +484,8 @@ void Queue<T>::serializeText(std::ostream& out) const {
     out << std::endl;
 }
 
-template<typename T>
-void Queue<T>::deserializeText(std::istream& in) {
+template<typename T, typename Alloc>
+void Queue<T, Alloc>::deserializeText(std::istream& in) {
     clear();
     size_t new_size;
     in >> new_size;
@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <string>  // Явно включено для поддержки std::string
 #include <utility> // Для std::swap
+#include "NodePool.h"
 
 /**
  * @brief Шаблонный класс Стека (Stack).
@@ -11,8 +12,10 @@
  * Элементы добавляются на "вершину" и извлекаются с "вершины".
  *
  * @tparam T Тип хранимых данных. Должен иметь конструктор по умолчанию (для внутренних операций копирования).
+ * @tparam Alloc Политика выделения узлов: DefaultNodeAllocator (new/delete)
+ *               или PooledNodeAllocator<> (переиспользование узлов через NodePool).
  */
-template<typename T>
+template<typename T, typename Alloc = DefaultNodeAllocator>
 class Stack {
 private:
     struct Node {
@@ -143,11 +146,11 @@ public:
     void deserializeText(std::istream& in);
 };
 
-template<typename T>
-Stack<T>::Stack() : top_node(nullptr), size(0) {}
+template<typename T, typename Alloc>
+Stack<T, Alloc>::Stack() : top_node(nullptr), size(0) {}
 
-template<typename T>
-Stack<T>::Stack(const Stack& other) : top_node(nullptr), size(0) {
+template<typename T, typename Alloc>
+Stack<T, Alloc>::Stack(const Stack& other) : top_node(nullptr), size(0) {
     if (other.top_node) {
         // Создаем временный массив для инвертирования порядка элементов.
         // Это необходимо, так как push добавляет в начало списка.
@@ -168,14 +171,14 @@ Stack<T>::Stack(const Stack& other) : top_node(nullptr), size(0) {
     }
 }
 
-template<typename T>
-Stack<T>& Stack<T>::operator=(const Stack& other) {
+template<typename T, typename Alloc>
+Stack<T, Alloc>& Stack<T, Alloc>::operator=(const Stack& other) {
     if (this != &other) {
         // Идиома Copy-and-Swap.
         // 1. Создаем копию через конструктор копирования.
         // Если здесь произойдет исключение (например, нехватка памяти при new T[]),
         // текущий объект останется нетронутым.
-        Stack<T> temp(other);
+        Stack temp(other);
 
         // 2. Обмениваем ресурсы.
         std::swap(top_node, temp.top_node);
@@ -186,68 +189,68 @@ Stack<T>& Stack<T>::operator=(const Stack& other) {
     return *this;
 }
 
-template<typename T>
-Stack<T>::~Stack() {
+template<typename T, typename Alloc>
+Stack<T, Alloc>::~Stack() {
     clear();
 }
 
-template<typename T>
-void Stack<T>::push(const T& element) {
-    Node* newNode = new Node(element);
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::push(const T& element) {
+    Node* newNode = Alloc::template create<Node>(element);
     newNode->next = top_node;
     top_node = newNode;
     ++size;
 }
 
-template<typename T>
-void Stack<T>::pop() {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::pop() {
     if (!top_node) {
         throw std::runtime_error("Stack is empty");
     }
     Node* temp = top_node;
     top_node = top_node->next;
-    delete temp;
+    Alloc::destroy(temp);
     --size;
 }
 
-template<typename T>
-T& Stack<T>::top() {
+template<typename T, typename Alloc>
+T& Stack<T, Alloc>::top() {
     if (!top_node) {
         throw std::runtime_error("Stack is empty");
     }
     return top_node->data;
 }
 
-template<typename T>
-const T& Stack<T>::top() const {
+template<typename T, typename Alloc>
+const T& Stack<T, Alloc>::top() const {
     if (!top_node) {
         throw std::runtime_error("Stack is empty");
     }
     return top_node->data;
 }
 
-template<typename T>
-size_t Stack<T>::getSize() const {
+template<typename T, typename Alloc>
+size_t Stack<T, Alloc>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool Stack<T>::isEmpty() const {
+template<typename T, typename Alloc>
+bool Stack<T, Alloc>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void Stack<T>::clear() {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::clear() {
     while (top_node) {
         Node* temp = top_node;
         top_node = top_node->next;
-        delete temp;
+        Alloc::destroy(temp);
     }
     size = 0;
 }
 
-template<typename T>
-void Stack<T>::print() const {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::print() const {
     std::cout << "Top -> [";
     Node* current = top_node;
     while (current) {
@@ -258,18 +261,18 @@ void Stack<T>::print() const {
     std::cout << "] <- Bottom" << std::endl;
 }
 
-template<typename T>
-void Stack<T>::serialize(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::serialize(std::ostream& out) const {
     serializeBinary(out);
 }
 
-template<typename T>
-void Stack<T>::deserialize(std::istream& in) {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::deserialize(std::istream& in) {
     deserializeBinary(in);
 }
 
-template<typename T>
-void Stack<T>::serializeBinary(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::serializeBinary(std::ostream& out) const {
     out.write(reinterpret_cast<const char*>(&size), sizeof(size));
 
     // Сохраняем элементы в обратном порядке (от дна к вершине), 
@@ -290,8 +293,8 @@ void Stack<T>::serializeBinary(std::ostream& out) const {
     }
 }
 
-template<typename T>
-void Stack<T>::deserializeBinary(std::istream& in) {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::deserializeBinary(std::istream& in) {
     clear();
     size_t new_size;
     in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
@@ -302,8 +305,8 @@ void Stack<T>::deserializeBinary(std::istream& in) {
     }
 }
 
-template<typename T>
-void Stack<T>::serializeText(std::ostream& out) const {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::serializeText(std::ostream& out) const {
     out << size << std::endl;
     
     // Сохраняем элементы в обратном порядке для сохранения структуры стека при десериализации
@@ -325,8 +328,8 @@ void Stack<T>::serializeText(std::ostream& out) const {
     out << std::endl;
 }
 
-template<typename T>
-void Stack<T>::deserializeText(std::istream& in) {
+template<typename T, typename Alloc>
+void Stack<T, Alloc>::deserializeText(std::istream& in) {
     clear();
     size_t new_size;
     in >> new_size;
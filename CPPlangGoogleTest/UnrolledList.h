@@ -0,0 +1,741 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility> // Для std::swap, std::move
+
+/**
+ * @brief Развернутый связный список (Unrolled Linked List).
+ *
+ * Двусвязный список, каждый узел которого хранит до NodeCapacity элементов во встроенном массиве.
+ * По сравнению с ForwardList/DoubleList обход затрагивает один промах кеша на NodeCapacity элементов,
+ * а накладные расходы на указатели делятся на все элементы узла.
+ *
+ * Вставка/удаление в начале и в конце выполняются за O(1) (сдвиг внутри одного узла ограничен
+ * NodeCapacity). Вставка в середину разделяет переполненный узел пополам, удаление сливает
+ * недозаполненный узел с соседним.
+ *
+ * @tparam T Тип элементов списка. Должен быть копируемым и конструируемым по умолчанию.
+ * @tparam NodeCapacity Количество элементов в одном узле (рекомендуется 16-64).
+ * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
+ */
+template<typename T, size_t NodeCapacity = 32>
+class UnrolledList {
+    static_assert(NodeCapacity >= 4, "NodeCapacity must be at least 4");
+
+private:
+    struct Node {
+        T items[NodeCapacity];
+        size_t count;
+        Node* next;
+        Node* prev;
+        Node() : count(0), next(nullptr), prev(nullptr) {}
+    };
+
+    Node* head;        ///< Первый узел
+    Node* tail;        ///< Последний узел
+    size_t size;       ///< Общее количество элементов
+    size_t node_count; ///< Количество узлов
+
+    Node* insertNodeAfter(Node* node);
+    void unlinkNode(Node* node);
+    Node* locate(size_t index, size_t& offset) const;
+    void splitNode(Node* node);
+    void mergeWithNext(Node* node);
+
+public:
+    /**
+     * @brief Однонаправленный итератор списка.
+     * Переход к следующему элементу внутри узла — сдвиг смещения, к следующему узлу —
+     * один переход по указателю на NodeCapacity элементов.
+     * @tparam IsConst true для константного итератора.
+     */
+    template<bool IsConst>
+    class IteratorBase {
+    private:
+        Node* node;
+        size_t offset;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        explicit IteratorBase(Node* n = nullptr, size_t off = 0) : node(n), offset(off) {}
+
+        /// Неявное преобразование iterator -> const_iterator.
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& other) : node(other.node), offset(other.offset) {}
+
+        reference operator*() const { return node->items[offset]; }
+        pointer operator->() const { return &node->items[offset]; }
+
+        IteratorBase& operator++() {
+            if (++offset == node->count) {
+                node = node->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const IteratorBase& other) const { return node == other.node && offset == other.offset; }
+        bool operator!=(const IteratorBase& other) const { return !(*this == other); }
+
+        template<bool> friend class IteratorBase;
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    /**
+     * @brief Конструктор по умолчанию.
+     * Создает пустой список.
+     */
+    UnrolledList();
+
+    /**
+     * @brief Копирующий конструктор.
+     * @param other Список-источник.
+     */
+    UnrolledList(const UnrolledList& other);
+
+    /**
+     * @brief Оператор присваивания.
+     * Выполняет глубокое копирование с гарантией безопасности исключений (strong exception guarantee).
+     * @param other Список-источник.
+     * @return Ссылка на текущий объект.
+     */
+    UnrolledList& operator=(const UnrolledList& other);
+
+    /**
+     * @brief Деструктор.
+     * Освобождает все узлы.
+     */
+    ~UnrolledList();
+
+    /**
+     * @brief Добавляет элемент в начало списка.
+     * Сложность: O(1) (сдвиг внутри первого узла).
+     * @param element Добавляемое значение.
+     */
+    void pushFront(const T& element);
+
+    /**
+     * @brief Добавляет элемент в конец списка.
+     * Сложность: O(1).
+     * @param element Добавляемое значение.
+     */
+    void pushBack(const T& element);
+
+    /**
+     * @brief Вставляет элемент по указанному индексу.
+     * Поиск узла: O(N / NodeCapacity), вставка внутри узла: O(NodeCapacity).
+     * Переполненный узел разделяется пополам.
+     * @param index Позиция вставки.
+     * @param element Добавляемое значение.
+     * @throw std::out_of_range Если index > size.
+     */
+    void insert(size_t index, const T& element);
+
+    /**
+     * @brief Удаляет первый элемент списка.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popFront();
+
+    /**
+     * @brief Удаляет последний элемент списка.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popBack();
+
+    /**
+     * @brief Удаляет элемент по индексу.
+     * Недозаполненный узел сливается со следующим, если их элементы помещаются в один узел.
+     * @param index Индекс удаляемого элемента.
+     * @throw std::out_of_range Если index >= size.
+     */
+    void remove(size_t index);
+
+    /**
+     * @brief Удаляет все элементы, равные заданному значению.
+     * Выполняется за один проход с уплотнением каждого узла.
+     * @param value Значение для удаления.
+     */
+    void removeValue(const T& value);
+
+    /**
+     * @brief Возвращает ссылку на элемент по индексу.
+     * Сложность: O(N / NodeCapacity).
+     * @param index Индекс элемента.
+     * @return T& Ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    T& get(size_t index);
+
+    /**
+     * @brief Возвращает константную ссылку на элемент по индексу.
+     * @param index Индекс элемента.
+     * @return const T& Константная ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    const T& get(size_t index) const;
+
+    /**
+     * @brief Возвращает первый элемент.
+     * @return T& Ссылка на первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает первый элемент (const).
+     * @return const T& Константная ссылка на первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    const T& front() const;
+
+    /**
+     * @brief Возвращает последний элемент.
+     * @return T& Ссылка на последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    /**
+     * @brief Возвращает последний элемент (const).
+     * @return const T& Константная ссылка на последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    const T& back() const;
+
+    /**
+     * @brief Итератор на первый элемент.
+     * @return iterator Начало списка.
+     */
+    iterator begin() { return iterator(head); }
+
+    /**
+     * @brief Итератор за последним элементом.
+     * @return iterator Конец списка.
+     */
+    iterator end() { return iterator(nullptr); }
+
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return const_iterator(head); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
+    /**
+     * @brief Обходит элементы по узлам: функция получает непрерывный массив каждого узла.
+     * @param func Функция вида void(const T* data, size_t count), вызываемая для каждого узла.
+     */
+    template<typename Func>
+    void forEachBlock(Func func) const;
+
+    /**
+     * @brief Возвращает текущее количество элементов.
+     * @return size_t Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Возвращает количество узлов (блоков) списка.
+     * @return size_t Число узлов.
+     */
+    size_t getNodeCount() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true Если список пуст.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Полностью очищает список.
+     */
+    void clear();
+
+    /**
+     * @brief Проверяет наличие значения в списке.
+     * Просмотр идет по непрерывным массивам узлов.
+     * @param value Искомое значение.
+     * @return true Если значение найдено.
+     */
+    bool find(const T& value) const;
+
+    /**
+     * @brief Выводит элементы списка, разделяя узлы символом '|'.
+     * Формат: [e1 e2 | e3 e4]
+     */
+    void print() const;
+
+    /**
+     * @brief Сериализация (обертка).
+     * По умолчанию вызывает serializeBinary.
+     * @param out Поток вывода.
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Десериализация (обертка).
+     * По умолчанию вызывает deserializeBinary.
+     * @param in Поток ввода.
+     */
+    void deserialize(std::istream& in);
+
+    /**
+     * @brief Бинарная сериализация.
+     * Формат совместим с ForwardList/DoubleList: размер, затем элементы.
+     * @warning Только для POD-типов.
+     * @param out Поток вывода.
+     */
+    void serializeBinary(std::ostream& out) const;
+
+    /**
+     * @brief Бинарная десериализация.
+     * @param in Поток ввода.
+     */
+    void deserializeBinary(std::istream& in);
+
+    /**
+     * @brief Текстовая сериализация.
+     * Формат: <размер>\n<значения через пробел>\n
+     * @param out Поток вывода.
+     */
+    void serializeText(std::ostream& out) const;
+
+    /**
+     * @brief Текстовая десериализация.
+     * @param in Поток ввода.
+     */
+    void deserializeText(std::istream& in);
+};
+
+template<typename T, size_t NodeCapacity>
+UnrolledList<T, NodeCapacity>::UnrolledList() : head(nullptr), tail(nullptr), size(0), node_count(0) {}
+
+template<typename T, size_t NodeCapacity>
+UnrolledList<T, NodeCapacity>::UnrolledList(const UnrolledList& other)
+    : head(nullptr), tail(nullptr), size(0), node_count(0) {
+    try {
+        for (Node* node = other.head; node; node = node->next) {
+            Node* copy = insertNodeAfter(tail);
+            for (size_t i = 0; i < node->count; ++i) {
+                copy->items[i] = node->items[i];
+            }
+            copy->count = node->count;
+            size += node->count;
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, size_t NodeCapacity>
+UnrolledList<T, NodeCapacity>& UnrolledList<T, NodeCapacity>::operator=(const UnrolledList& other) {
+    if (this != &other) {
+        // Идиома copy-and-swap
+        UnrolledList temp(other);
+        std::swap(head, temp.head);
+        std::swap(tail, temp.tail);
+        std::swap(size, temp.size);
+        std::swap(node_count, temp.node_count);
+    }
+    return *this;
+}
+
+template<typename T, size_t NodeCapacity>
+UnrolledList<T, NodeCapacity>::~UnrolledList() {
+    clear();
+}
+
+// Создает пустой узел после node (nullptr — в начало списка)
+template<typename T, size_t NodeCapacity>
+typename UnrolledList<T, NodeCapacity>::Node* UnrolledList<T, NodeCapacity>::insertNodeAfter(Node* node) {
+    Node* newNode = new Node();
+    if (!node) {
+        newNode->next = head;
+        if (head) head->prev = newNode;
+        head = newNode;
+        if (!tail) tail = newNode;
+    } else {
+        newNode->prev = node;
+        newNode->next = node->next;
+        if (node->next) node->next->prev = newNode;
+        else tail = newNode;
+        node->next = newNode;
+    }
+    ++node_count;
+    return newNode;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::unlinkNode(Node* node) {
+    if (node->prev) node->prev->next = node->next;
+    else head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else tail = node->prev;
+    delete node;
+    --node_count;
+}
+
+// Находит узел, содержащий элемент index, и смещение элемента внутри узла
+template<typename T, size_t NodeCapacity>
+typename UnrolledList<T, NodeCapacity>::Node* UnrolledList<T, NodeCapacity>::locate(size_t index, size_t& offset) const {
+    if (index <= size / 2) {
+        Node* node = head;
+        while (index >= node->count) {
+            index -= node->count;
+            node = node->next;
+        }
+        offset = index;
+        return node;
+    }
+
+    // Идем с конца: считаем позицию от хвоста
+    size_t from_back = size - 1 - index;
+    Node* node = tail;
+    while (from_back >= node->count) {
+        from_back -= node->count;
+        node = node->prev;
+    }
+    offset = node->count - 1 - from_back;
+    return node;
+}
+
+// Переносит верхнюю половину элементов заполненного узла в новый узел после него
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::splitNode(Node* node) {
+    Node* right = insertNodeAfter(node);
+    size_t half = node->count / 2;
+    for (size_t i = half; i < node->count; ++i) {
+        right->items[i - half] = std::move(node->items[i]);
+    }
+    right->count = node->count - half;
+    node->count = half;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::mergeWithNext(Node* node) {
+    Node* next = node->next;
+    for (size_t i = 0; i < next->count; ++i) {
+        node->items[node->count + i] = std::move(next->items[i]);
+    }
+    node->count += next->count;
+    unlinkNode(next);
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::pushFront(const T& element) {
+    T value(element); // копирование может бросить исключение, пока список не изменен
+    if (!head || head->count == NodeCapacity) {
+        insertNodeAfter(nullptr);
+    }
+    for (size_t i = head->count; i > 0; --i) {
+        head->items[i] = std::move(head->items[i - 1]);
+    }
+    head->items[0] = std::move(value);
+    ++head->count;
+    ++size;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::pushBack(const T& element) {
+    T value(element); // копирование может бросить исключение, пока список не изменен
+    if (!tail || tail->count == NodeCapacity) {
+        insertNodeAfter(tail);
+    }
+    tail->items[tail->count] = std::move(value);
+    ++tail->count;
+    ++size;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::insert(size_t index, const T& element) {
+    if (index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == size) {
+        pushBack(element);
+        return;
+    }
+
+    T value(element);
+    size_t offset;
+    Node* node = locate(index, offset);
+    if (node->count == NodeCapacity) {
+        splitNode(node);
+        if (offset > node->count) {
+            offset -= node->count;
+            node = node->next;
+        }
+    }
+    for (size_t i = node->count; i > offset; --i) {
+        node->items[i] = std::move(node->items[i - 1]);
+    }
+    node->items[offset] = std::move(value);
+    ++node->count;
+    ++size;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::popFront() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    for (size_t i = 1; i < head->count; ++i) {
+        head->items[i - 1] = std::move(head->items[i]);
+    }
+    head->items[--head->count] = T();
+    if (head->count == 0) {
+        unlinkNode(head);
+    }
+    --size;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::popBack() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    tail->items[--tail->count] = T();
+    if (tail->count == 0) {
+        unlinkNode(tail);
+    }
+    --size;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::remove(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+
+    size_t offset;
+    Node* node = locate(index, offset);
+    for (size_t i = offset + 1; i < node->count; ++i) {
+        node->items[i - 1] = std::move(node->items[i]);
+    }
+    node->items[--node->count] = T();
+    --size;
+
+    if (node->count == 0) {
+        unlinkNode(node);
+    } else if (node->count < NodeCapacity / 2 && node->next &&
+               node->count + node->next->count <= NodeCapacity) {
+        mergeWithNext(node);
+    }
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::removeValue(const T& value) {
+    Node* node = head;
+    while (node) {
+        size_t kept = 0;
+        for (size_t i = 0; i < node->count; ++i) {
+            if (!(node->items[i] == value)) {
+                if (kept != i) node->items[kept] = std::move(node->items[i]);
+                ++kept;
+            }
+        }
+        for (size_t i = kept; i < node->count; ++i) {
+            node->items[i] = T();
+        }
+        size -= node->count - kept;
+        node->count = kept;
+
+        Node* next = node->next;
+        if (node->count == 0) {
+            unlinkNode(node);
+        } else if (next && node->count + next->count <= NodeCapacity / 2) {
+            // Следующий узел будет уплотнен на следующей итерации, поэтому сливаем
+            // только заведомо малые пары, оставляя запас для последующих вставок
+            mergeWithNext(node);
+            continue;
+        }
+        node = next;
+    }
+}
+
+template<typename T, size_t NodeCapacity>
+T& UnrolledList<T, NodeCapacity>::get(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    size_t offset;
+    Node* node = locate(index, offset);
+    return node->items[offset];
+}
+
+template<typename T, size_t NodeCapacity>
+const T& UnrolledList<T, NodeCapacity>::get(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    size_t offset;
+    Node* node = locate(index, offset);
+    return node->items[offset];
+}
+
+template<typename T, size_t NodeCapacity>
+T& UnrolledList<T, NodeCapacity>::front() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    return head->items[0];
+}
+
+template<typename T, size_t NodeCapacity>
+const T& UnrolledList<T, NodeCapacity>::front() const {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    return head->items[0];
+}
+
+template<typename T, size_t NodeCapacity>
+T& UnrolledList<T, NodeCapacity>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail->items[tail->count - 1];
+}
+
+template<typename T, size_t NodeCapacity>
+const T& UnrolledList<T, NodeCapacity>::back() const {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail->items[tail->count - 1];
+}
+
+template<typename T, size_t NodeCapacity>
+template<typename Func>
+void UnrolledList<T, NodeCapacity>::forEachBlock(Func func) const {
+    for (Node* node = head; node; node = node->next) {
+        func(static_cast<const T*>(node->items), node->count);
+    }
+}
+
+template<typename T, size_t NodeCapacity>
+size_t UnrolledList<T, NodeCapacity>::getSize() const {
+    return size;
+}
+
+template<typename T, size_t NodeCapacity>
+size_t UnrolledList<T, NodeCapacity>::getNodeCount() const {
+    return node_count;
+}
+
+template<typename T, size_t NodeCapacity>
+bool UnrolledList<T, NodeCapacity>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::clear() {
+    while (head) {
+        Node* temp = head;
+        head = head->next;
+        delete temp;
+    }
+    head = tail = nullptr;
+    size = 0;
+    node_count = 0;
+}
+
+template<typename T, size_t NodeCapacity>
+bool UnrolledList<T, NodeCapacity>::find(const T& value) const {
+    for (Node* node = head; node; node = node->next) {
+        for (size_t i = 0; i < node->count; ++i) {
+            if (node->items[i] == value) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::print() const {
+    std::cout << "[";
+    for (Node* node = head; node; node = node->next) {
+        for (size_t i = 0; i < node->count; ++i) {
+            std::cout << node->items[i];
+            if (i + 1 < node->count) std::cout << " ";
+        }
+        if (node->next) std::cout << " | ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::serialize(std::ostream& out) const {
+    serializeBinary(out);
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::deserialize(std::istream& in) {
+    deserializeBinary(in);
+}
+
+// Важно: бинарная сериализация корректна только для тривиально копируемых типов
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::serializeBinary(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (Node* node = head; node; node = node->next) {
+        // Элементы узла лежат в памяти непрерывно и пишутся одним вызовом
+        out.write(reinterpret_cast<const char*>(node->items), sizeof(T) * node->count);
+    }
+}
+
+// Важно: бинарная десериализация корректна только для тривиально копируемых типов
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::deserializeBinary(std::istream& in) {
+    clear();
+    size_t new_size;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        pushBack(value);
+    }
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::serializeText(std::ostream& out) const {
+    out << size << std::endl;
+    bool first = true;
+    for (Node* node = head; node; node = node->next) {
+        for (size_t i = 0; i < node->count; ++i) {
+            if (!first) out << " ";
+            out << node->items[i];
+            first = false;
+        }
+    }
+    out << std::endl;
+}
+
+template<typename T, size_t NodeCapacity>
+void UnrolledList<T, NodeCapacity>::deserializeText(std::istream& in) {
+    clear();
+    size_t new_size;
+    in >> new_size;
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in >> value;
+        pushBack(value);
+    }
+}
@@ -0,0 +1,638 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <iterator>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+#include <utility> // Для std::swap, std::move
+
+/**
+ * @brief Компактный двусвязный список с XOR-связями (XOR Linked List).
+ *
+ * Вместо двух указателей prev/next каждый узел хранит одно поле link = prev ^ next,
+ * а узлы размещаются в общем пуле и адресуются индексами типа Index (по умолчанию 32 бита).
+ * Для XorList<int> узел занимает 8 байт против 24 байт узла DoubleList<int>
+ * плюс служебные данные аллокатора на каждый узел.
+ *
+ * Обход возможен с обоих концов: зная соседний узел, следующий получается как link ^ сосед.
+ * Индекс 0 зарезервирован как "пустая" ссылка, освобожденные узлы образуют список свободных.
+ *
+ * @tparam T Тип элементов. Должен быть копируемым и конструируемым по умолчанию.
+ * @tparam Index Беззнаковый тип индекса узла; ограничивает максимальный размер списка.
+ * @warning Бинарная сериализация корректна только для тривиально копируемых типов (POD).
+ */
+template<typename T, typename Index = uint32_t>
+class XorList {
+private:
+    static_assert(std::numeric_limits<Index>::is_integer && !std::numeric_limits<Index>::is_signed,
+                  "Index must be an unsigned integer type");
+
+    struct Node {
+        T data;
+        Index link; ///< prev ^ next для занятого узла, следующий свободный — для свободного
+    };
+
+    Node* pool;       ///< Пул узлов; pool[0] не используется
+    size_t capacity;  ///< Количество ячеек пула (включая нулевую)
+    size_t used;      ///< Количество когда-либо выданных ячеек (следующая новая ячейка)
+    Index freeHead;   ///< Первый свободный узел (0 - нет)
+    Index head;       ///< Индекс первого элемента (0 - список пуст)
+    Index tail;       ///< Индекс последнего элемента
+    size_t size;      ///< Текущее количество элементов
+
+    Index allocateNode(const T& value);
+    void releaseNode(Index index);
+    void grow();
+    void locate(size_t index, Index& prev, Index& curr) const;
+
+public:
+    /**
+     * @brief Двунаправленный итератор. Хранит пару (предыдущий, текущий) индексов.
+     * @tparam IsConst true для константного итератора.
+     */
+    template<bool IsConst>
+    class IteratorBase {
+    private:
+        using ListPtr = typename std::conditional<IsConst, const XorList*, XorList*>::type;
+        ListPtr list;
+        Index prev;
+        Index curr;
+        friend class XorList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        IteratorBase() : list(nullptr), prev(0), curr(0) {}
+        IteratorBase(ListPtr owner, Index p, Index c) : list(owner), prev(p), curr(c) {}
+
+        /// Неявное преобразование iterator -> const_iterator.
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorBase(const IteratorBase<OtherConst>& other) : list(other.list), prev(other.prev), curr(other.curr) {}
+
+        reference operator*() const { return list->pool[curr].data; }
+        pointer operator->() const { return &list->pool[curr].data; }
+
+        IteratorBase& operator++() {
+            Index next = list->pool[curr].link ^ prev;
+            prev = curr;
+            curr = next;
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        IteratorBase& operator--() {
+            Index before = list->pool[prev].link ^ curr;
+            curr = prev;
+            prev = before;
+            return *this;
+        }
+
+        IteratorBase operator--(int) {
+            IteratorBase copy = *this;
+            --*this;
+            return copy;
+        }
+
+        bool operator==(const IteratorBase& other) const { return curr == other.curr && prev == other.prev; }
+        bool operator!=(const IteratorBase& other) const { return !(*this == other); }
+
+        template<bool> friend class IteratorBase;
+    };
+
+    using iterator = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой список без выделения памяти.
+     */
+    XorList();
+
+    /**
+     * @brief Копирующий конструктор. Копирует пул целиком (индексы сохраняются).
+     * @param other Список-источник.
+     */
+    XorList(const XorList& other);
+
+    /**
+     * @brief Оператор присваивания (copy-and-swap).
+     * @param other Список-источник.
+     * @return Ссылка на текущий объект.
+     */
+    XorList& operator=(const XorList& other);
+
+    /**
+     * @brief Деструктор. Освобождает пул.
+     */
+    ~XorList();
+
+    /**
+     * @brief Добавляет элемент в начало списка. Сложность: O(1) амортизированно.
+     * @param element Значение для добавления.
+     * @throw std::runtime_error Если количество узлов превышает предел типа Index.
+     */
+    void pushFront(const T& element);
+
+    /**
+     * @brief Добавляет элемент в конец списка. Сложность: O(1) амортизированно.
+     * @param element Значение для добавления.
+     * @throw std::runtime_error Если количество узлов превышает предел типа Index.
+     */
+    void pushBack(const T& element);
+
+    /**
+     * @brief Вставляет элемент по индексу. Сложность: O(min(index, size - index)).
+     * @param index Позиция вставки (0 - начало, size - конец).
+     * @param element Значение для вставки.
+     * @throw std::out_of_range Если index > size.
+     */
+    void insert(size_t index, const T& element);
+
+    /**
+     * @brief Удаляет первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popFront();
+
+    /**
+     * @brief Удаляет последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    void popBack();
+
+    /**
+     * @brief Удаляет элемент по индексу. Сложность: O(min(index, size - index)).
+     * @param index Индекс удаляемого элемента.
+     * @throw std::out_of_range Если index >= size.
+     */
+    void remove(size_t index);
+
+    /**
+     * @brief Возвращает ссылку на элемент по индексу (обход с ближайшего конца).
+     * @param index Индекс элемента.
+     * @return T& Ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    T& get(size_t index);
+
+    /**
+     * @brief Возвращает константную ссылку на элемент по индексу.
+     * @param index Индекс элемента.
+     * @return const T& Константная ссылка на элемент.
+     * @throw std::out_of_range Если index >= size.
+     */
+    const T& get(size_t index) const;
+
+    /**
+     * @brief Возвращает первый элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& front();
+
+    /**
+     * @brief Возвращает последний элемент.
+     * @throw std::runtime_error Если список пуст.
+     */
+    T& back();
+
+    iterator begin() { return iterator(this, 0, head); }
+    iterator end() { return iterator(this, tail, 0); }
+    const_iterator begin() const { return const_iterator(this, 0, head); }
+    const_iterator end() const { return const_iterator(this, tail, 0); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    /**
+     * @brief Возвращает количество элементов.
+     * @return Размер списка.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Проверяет, пуст ли список.
+     * @return true, если элементов нет.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Возвращает объем памяти, занимаемый списком (пул и сам объект).
+     * @return Размер в байтах.
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Удаляет все элементы. Пул сохраняется для повторного использования.
+     */
+    void clear();
+
+    /**
+     * @brief Линейный поиск значения.
+     * @param value Искомое значение.
+     * @return true, если значение найдено.
+     */
+    bool find(const T& value) const;
+
+    /**
+     * @brief Выводит элементы от головы к хвосту. Формат: [e1 <-> e2 <-> e3]
+     */
+    void print() const;
+
+    /**
+     * @brief Выводит элементы от хвоста к голове.
+     */
+    void printReverse() const;
+
+    /**
+     * @brief Сериализация (обертка над serializeBinary).
+     * @param out Поток вывода.
+     */
+    void serialize(std::ostream& out) const;
+
+    /**
+     * @brief Десериализация (обертка над deserializeBinary).
+     * @param in Поток ввода.
+     */
+    void deserialize(std::istream& in);
+
+    /**
+     * @brief Бинарная сериализация: размер и значения по порядку (пул не сохраняется).
+     * @warning Только для POD-типов.
+     * @param out Поток вывода.
+     */
+    void serializeBinary(std::ostream& out) const;
+
+    /**
+     * @brief Бинарная десериализация. Очищает список и восстанавливает элементы.
+     * @warning Только для POD-типов.
+     * @param in Поток ввода.
+     */
+    void deserializeBinary(std::istream& in);
+
+    /**
+     * @brief Текстовая сериализация. Формат: <размер>\n<значения через пробел>\n
+     * @param out Поток вывода.
+     */
+    void serializeText(std::ostream& out) const;
+
+    /**
+     * @brief Текстовая десериализация.
+     * @param in Поток ввода.
+     */
+    void deserializeText(std::istream& in);
+};
+
+template<typename T, typename Index>
+XorList<T, Index>::XorList()
+    : pool(nullptr), capacity(0), used(1), freeHead(0), head(0), tail(0), size(0) {}
+
+template<typename T, typename Index>
+XorList<T, Index>::XorList(const XorList& other)
+    : pool(nullptr), capacity(other.capacity), used(other.used), freeHead(other.freeHead),
+      head(other.head), tail(other.tail), size(other.size) {
+    if (capacity > 0) {
+        pool = new Node[capacity];
+        for (size_t i = 1; i < used; ++i) {
+            pool[i] = other.pool[i];
+        }
+    }
+}
+
+template<typename T, typename Index>
+XorList<T, Index>& XorList<T, Index>::operator=(const XorList& other) {
+    if (this != &other) {
+        XorList temp(other);
+        std::swap(pool, temp.pool);
+        std::swap(capacity, temp.capacity);
+        std::swap(used, temp.used);
+        std::swap(freeHead, temp.freeHead);
+        std::swap(head, temp.head);
+        std::swap(tail, temp.tail);
+        std::swap(size, temp.size);
+    }
+    return *this;
+}
+
+template<typename T, typename Index>
+XorList<T, Index>::~XorList() {
+    delete[] pool;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::grow() {
+    const size_t limit = static_cast<size_t>(std::numeric_limits<Index>::max());
+    if (capacity > limit) {
+        throw std::runtime_error("XorList capacity exceeded");
+    }
+    size_t new_capacity = capacity == 0 ? 16 : capacity * 2;
+    if (new_capacity - 1 > limit) {
+        new_capacity = limit + 1;
+    }
+    Node* new_pool = new Node[new_capacity];
+    for (size_t i = 1; i < used; ++i) {
+        new_pool[i].data = std::move(pool[i].data);
+        new_pool[i].link = pool[i].link;
+    }
+    delete[] pool;
+    pool = new_pool;
+    capacity = new_capacity;
+}
+
+template<typename T, typename Index>
+Index XorList<T, Index>::allocateNode(const T& value) {
+    Index index;
+    if (freeHead) {
+        index = freeHead;
+        freeHead = pool[index].link;
+    } else {
+        if (used >= capacity) {
+            if (capacity > 0 && capacity - 1 == static_cast<size_t>(std::numeric_limits<Index>::max())) {
+                throw std::runtime_error("XorList capacity exceeded");
+            }
+            grow();
+        }
+        index = static_cast<Index>(used++);
+    }
+    pool[index].data = value;
+    pool[index].link = 0;
+    return index;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::releaseNode(Index index) {
+    pool[index].data = T();
+    pool[index].link = freeHead;
+    freeHead = index;
+}
+
+// Находит узел с индексом index (< size) и его соседа со стороны головы
+template<typename T, typename Index>
+void XorList<T, Index>::locate(size_t index, Index& prev, Index& curr) const {
+    if (index <= size / 2) {
+        prev = 0;
+        curr = head;
+        for (size_t i = 0; i < index; ++i) {
+            Index next = pool[curr].link ^ prev;
+            prev = curr;
+            curr = next;
+        }
+    } else {
+        // Идем с хвоста, запоминая соседа справа; затем вычисляем левого
+        Index next = 0;
+        curr = tail;
+        for (size_t i = 0; i < size - 1 - index; ++i) {
+            Index before = pool[curr].link ^ next;
+            next = curr;
+            curr = before;
+        }
+        prev = pool[curr].link ^ next;
+    }
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::pushFront(const T& element) {
+    Index node = allocateNode(element);
+    pool[node].link = head;
+    if (head) pool[head].link ^= node;
+    else tail = node;
+    head = node;
+    ++size;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::pushBack(const T& element) {
+    Index node = allocateNode(element);
+    pool[node].link = tail;
+    if (tail) pool[tail].link ^= node;
+    else head = node;
+    tail = node;
+    ++size;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::insert(size_t index, const T& element) {
+    if (index > size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == 0) {
+        pushFront(element);
+        return;
+    }
+    if (index == size) {
+        pushBack(element);
+        return;
+    }
+
+    Index prev, curr;
+    locate(index, prev, curr);
+    Index node = allocateNode(element);
+    pool[node].link = prev ^ curr;
+    pool[prev].link ^= curr ^ node;
+    pool[curr].link ^= prev ^ node;
+    ++size;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::popFront() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    Index old = head;
+    head = pool[old].link; // у головы link == next
+    if (head) pool[head].link ^= old;
+    else tail = 0;
+    releaseNode(old);
+    --size;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::popBack() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    Index old = tail;
+    tail = pool[old].link; // у хвоста link == prev
+    if (tail) pool[tail].link ^= old;
+    else head = 0;
+    releaseNode(old);
+    --size;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::remove(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == 0) {
+        popFront();
+        return;
+    }
+    if (index == size - 1) {
+        popBack();
+        return;
+    }
+
+    Index prev, curr;
+    locate(index, prev, curr);
+    Index next = pool[curr].link ^ prev;
+    pool[prev].link ^= curr ^ next;
+    pool[next].link ^= curr ^ prev;
+    releaseNode(curr);
+    --size;
+}
+
+template<typename T, typename Index>
+T& XorList<T, Index>::get(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    Index prev, curr;
+    locate(index, prev, curr);
+    return pool[curr].data;
+}
+
+template<typename T, typename Index>
+const T& XorList<T, Index>::get(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of range");
+    }
+    Index prev, curr;
+    locate(index, prev, curr);
+    return pool[curr].data;
+}
+
+template<typename T, typename Index>
+T& XorList<T, Index>::front() {
+    if (!head) {
+        throw std::runtime_error("List is empty");
+    }
+    return pool[head].data;
+}
+
+template<typename T, typename Index>
+T& XorList<T, Index>::back() {
+    if (!tail) {
+        throw std::runtime_error("List is empty");
+    }
+    return pool[tail].data;
+}
+
+template<typename T, typename Index>
+size_t XorList<T, Index>::getSize() const {
+    return size;
+}
+
+template<typename T, typename Index>
+bool XorList<T, Index>::isEmpty() const {
+    return size == 0;
+}
+
+template<typename T, typename Index>
+size_t XorList<T, Index>::memoryUsage() const {
+    return sizeof(*this) + capacity * sizeof(Node);
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::clear() {
+    for (size_t i = 1; i < used; ++i) {
+        pool[i].data = T();
+    }
+    used = 1;
+    freeHead = head = tail = 0;
+    size = 0;
+}
+
+template<typename T, typename Index>
+bool XorList<T, Index>::find(const T& value) const {
+    for (const T& element : *this) {
+        if (element == value) return true;
+    }
+    return false;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::print() const {
+    std::cout << "[";
+    for (const_iterator it = begin(); it != end(); ++it) {
+        if (it != begin()) std::cout << " <-> ";
+        std::cout << *it;
+    }
+    std::cout << "]" << std::endl;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::printReverse() const {
+    std::cout << "[";
+    for (const_reverse_iterator it = rbegin(); it != rend(); ++it) {
+        if (it != rbegin()) std::cout << " <-> ";
+        std::cout << *it;
+    }
+    std::cout << "]" << std::endl;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::serialize(std::ostream& out) const {
+    serializeBinary(out);
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::deserialize(std::istream& in) {
+    deserializeBinary(in);
+}
+
+// Важно: бинарная сериализация корректна только для тривиально копируемых типов
+template<typename T, typename Index>
+void XorList<T, Index>::serializeBinary(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (const T& element : *this) {
+        out.write(reinterpret_cast<const char*>(&element), sizeof(T));
+    }
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::deserializeBinary(std::istream& in) {
+    clear();
+    size_t new_size;
+    in.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        pushBack(value);
+    }
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::serializeText(std::ostream& out) const {
+    out << size << std::endl;
+    bool first = true;
+    for (const T& element : *this) {
+        if (!first) out << " ";
+        out << element;
+        first = false;
+    }
+    out << std::endl;
+}
+
+template<typename T, typename Index>
+void XorList<T, Index>::deserializeText(std::istream& in) {
+    clear();
+    size_t new_size;
+    in >> new_size;
+    for (size_t i = 0; i < new_size; ++i) {
+        T value;
+        in >> value;
+        pushBack(value);
+    }
+}
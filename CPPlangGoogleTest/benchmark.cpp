@@ -13,13 +13,33 @@
 #include <random>
 #include <iomanip>
 #include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 #include "Array.h"
 #include "ForwardList.h"
 #include "DoubleList.h"
+#include "UnrolledList.h"
+#include "IntrusiveList.h"
+#include "IndexedSkipList.h"
+#include "XorList.h"
+#include "Deque.h"
+#include "LockFreeList.h"
+#include "ConcurrentDeque.h"
 #include "Queue.h"
+#include "PersistentQueue.h"
+#include "DelayQueue.h"
 #include "Stack.h"
 #include "HashTable.h"
 #include "FullBinaryTree.h"
+#include "ImplicitFullBinaryTree.h"
+#include "NodePool.h"
 
 /**
  * @brief Глобальный поток вывода в файл.
@@ -95,6 +115,17 @@ void print_result(const std::string& operation, double time_ms, int operations)
     }
 }
 
+/**
+ * @brief Выводит произвольную информационную строку в консоль и файл.
+ * @param line Текст строки.
+ */
+void print_info(const std::string& line) {
+    std::cout << line << std::endl;
+    if (resultsFile.is_open()) {
+        resultsFile << line << std::endl;
+    }
+}
+
 /**
  * @brief Тестирование производительности динамического массива (Array).
  *
@@ -171,6 +202,16 @@ void benchmark_forward_list() {
     double insert_time = timer.stop();
     print_result("Insert Front", insert_time, N);
 
+    // Вставка в хвост (O(1) благодаря указателю на хвост)
+    const int BIG_N = 1000000;
+    ForwardList<int> appended;
+    timer.start();
+    for (int i = 0; i < BIG_N; ++i) {
+        appended.pushBack(i);
+    }
+    double push_back_time = timer.stop();
+    print_result("Push Back 1M", push_back_time, BIG_N);
+
     // Последовательный доступ
     timer.start();
     volatile int sum = 0;
@@ -180,6 +221,14 @@ void benchmark_forward_list() {
     double access_time = timer.stop();
     print_result("Sequential Access", access_time, 1000);
 
+    // Полный обход итератором: O(N) вместо O(N^2) для get(i)
+    timer.start();
+    for (int value : list) {
+        sum += value;
+    }
+    double iterate_time = timer.stop();
+    print_result("Iterate All", iterate_time, static_cast<int>(list.getSize()));
+
     // Поиск значения
     timer.start();
     int found_count = 0;
@@ -198,6 +247,35 @@ void benchmark_forward_list() {
     }
     double remove_time = timer.stop();
     print_result("Remove Front", remove_time, 1000);
+
+    // Очистка "мусора" по набору значений: K проходов removeValue против одного removeIf
+    const int SWEEP_N = 100000;
+    const int SWEEP_K = 64;
+    ForwardList<int> sweep_values;
+    ForwardList<int> sweep_pred;
+    ForwardList<int, PooledNodeAllocator<SWEEP_N>> sweep_pooled;
+    for (int i = 0; i < SWEEP_N; ++i) {
+        sweep_values.pushBack(i % 1000);
+        sweep_pred.pushBack(i % 1000);
+        sweep_pooled.pushBack(i % 1000);
+    }
+    timer.start();
+    for (int v = 0; v < SWEEP_K; ++v) {
+        sweep_values.removeValue(v);
+    }
+    double sweep_values_time = timer.stop();
+    print_result("Sweep removeValue x64", sweep_values_time, SWEEP_N);
+
+    timer.start();
+    size_t swept = sweep_pred.removeIf([](int v) { return v < SWEEP_K; });
+    double sweep_pred_time = timer.stop();
+    print_result("Sweep removeIf", sweep_pred_time, SWEEP_N);
+
+    timer.start();
+    sweep_pooled.removeIf([](int v) { return v < SWEEP_K; });
+    double sweep_pooled_time = timer.stop();
+    print_result("Sweep removeIf (pooled)", sweep_pooled_time, SWEEP_N);
+    print_info("Removed per sweep: " + std::to_string(swept));
 }
 
 /**
@@ -247,6 +325,726 @@ void benchmark_double_list() {
     }
     double remove_time = timer.stop();
     print_result("Remove Back", remove_time, 1000);
+
+    // Индексный доступ с разной локальностью: палец делает соседние обращения O(расстояние)
+    const int BIG_N = 100000;
+    DoubleList<int> big;
+    for (int i = 0; i < BIG_N; ++i) {
+        big.pushBack(i);
+    }
+    timer.start();
+    for (int i = 0; i < BIG_N; ++i) {
+        sum += big.get(i);
+    }
+    double finger_seq_time = timer.stop();
+    print_result("Get Sequential 100k", finger_seq_time, BIG_N);
+
+    const int STRIDE = 16;
+    timer.start();
+    for (int start = 0; start < STRIDE; ++start) {
+        for (int i = start; i < BIG_N; i += STRIDE) {
+            sum += big.get(i);
+        }
+    }
+    double finger_stride_time = timer.stop();
+    print_result("Get Strided x16", finger_stride_time, BIG_N);
+
+    const int RANDOM_OPS = 2000;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> index_dist(0, BIG_N - 1);
+    timer.start();
+    for (int i = 0; i < RANDOM_OPS; ++i) {
+        sum += big.get(index_dist(rng));
+    }
+    double finger_random_time = timer.stop();
+    print_result("Get Random", finger_random_time, RANDOM_OPS);
+
+    timer.start();
+    for (int i = 0; i < 10000; ++i) {
+        big.insert(BIG_N / 2 + i, i);
+    }
+    double finger_insert_time = timer.stop();
+    print_result("Insert Consecutive Middle", finger_insert_time, 10000);
+
+    // Линейные алгоритмы через итераторы: без копирования в Array и без индексов
+    timer.start();
+    for (int value : big) {
+        sum += value;
+    }
+    double iterate_time = timer.stop();
+    print_result("Iterate All", iterate_time, static_cast<int>(big.getSize()));
+
+    timer.start();
+    for (auto it = big.rbegin(); it != big.rend(); ++it) {
+        sum += *it;
+    }
+    double reverse_time = timer.stop();
+    print_result("Reverse Iterate All", reverse_time, static_cast<int>(big.getSize()));
+
+    timer.start();
+    Array<int> copied;
+    for (size_t i = 0; i < big.getSize(); ++i) {
+        copied.add(big.get(i));
+    }
+    double copy_time = timer.stop();
+    print_result("Copy to Array via get(i)", copy_time, static_cast<int>(big.getSize()));
+
+    int erase_ops = static_cast<int>(big.getSize());
+    timer.start();
+    for (auto it = big.begin(); it != big.end();) {
+        if (*it % 2 == 0) it = big.erase(it);
+        else ++it;
+    }
+    double erase_time = timer.stop();
+    print_result("Erase Evens via Iterator", erase_time, erase_ops);
+}
+
+/**
+ * @brief Тестирование развернутого списка (UnrolledList).
+ *
+ * Повторяет сценарии ForwardList/DoubleList (последовательный доступ и поиск),
+ * а также вставку в середину с разделением узлов.
+ */
+void benchmark_unrolled_list() {
+    print_header("UNROLLED LIST");
+
+    const int N = 10000;
+    BenchmarkTimer timer;
+
+    UnrolledList<int> list;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        list.pushBack(i);
+    }
+    double insert_time = timer.stop();
+    print_result("Insert Back", insert_time, N);
+
+    timer.start();
+    volatile int sum = 0;
+    for (size_t i = 0; i < list.getSize() && i < 1000; ++i) {
+        sum += list.get(i);
+    }
+    double access_time = timer.stop();
+    print_result("Sequential Access", access_time, 1000);
+
+    // Полный обход итератором: O(N) вместо O(N * N / NodeCapacity) для get(i)
+    timer.start();
+    for (int value : list) {
+        sum += value;
+    }
+    double iterate_time = timer.stop();
+    print_result("Iterate All", iterate_time, static_cast<int>(list.getSize()));
+
+    timer.start();
+    long long block_sum = 0;
+    list.forEachBlock([&block_sum](const int* data, size_t count) {
+        for (size_t i = 0; i < count; ++i) block_sum += data[i];
+    });
+    sum += static_cast<int>(block_sum);
+    double block_time = timer.stop();
+    print_result("Iterate Blocks", block_time, static_cast<int>(list.getSize()));
+
+    timer.start();
+    volatile int found_count = 0;
+    for (int i = 0; i < 1000; ++i) {
+        if (list.find(N - 1 - i)) {
+            found_count++;
+        }
+    }
+    double find_time = timer.stop();
+    print_result("Find", find_time, 1000);
+
+    timer.start();
+    for (int i = 0; i < 1000; ++i) {
+        list.insert(list.getSize() / 2, i);
+    }
+    double middle_time = timer.stop();
+    print_result("Insert Middle", middle_time, 1000);
+
+    timer.start();
+    for (int i = 0; i < 1000 && list.getSize() > 0; ++i) {
+        list.popFront();
+    }
+    double remove_time = timer.stop();
+    print_result("Remove Front", remove_time, 1000);
+
+    print_info("Nodes: " + std::to_string(list.getNodeCount()) +
+               " for " + std::to_string(list.getSize()) + " elements");
+}
+
+/**
+ * @brief Масштабирование позиционных операций: IndexedSkipList против DoubleList.
+ *
+ * Для каждого размера выполняются случайные insert(index) и get(index).
+ * У DoubleList стоимость растет линейно с размером, у списка с пропусками — логарифмически.
+ * DoubleList на 1M элементов пропускается: серия из тысяч случайных операций заняла бы минуты.
+ */
+void benchmark_indexed_skip_list() {
+    print_header("INDEXED SKIP LIST");
+
+    const int OPS = 2000;
+    BenchmarkTimer timer;
+    volatile long long sum = 0;
+
+    for (int n : {10000, 100000, 1000000}) {
+        std::mt19937 rng(n);
+        const std::string suffix = " @" + std::to_string(n);
+
+        IndexedSkipList<int> skip;
+        timer.start();
+        for (int i = 0; i < n; ++i) {
+            skip.pushBack(i);
+        }
+        double build_time = timer.stop();
+        print_result("Skip Push Back" + suffix, build_time, n);
+
+        timer.start();
+        for (int i = 0; i < OPS; ++i) {
+            skip.insert(rng() % (skip.getSize() + 1), i);
+        }
+        double skip_insert_time = timer.stop();
+        print_result("Skip Random Insert" + suffix, skip_insert_time, OPS);
+
+        timer.start();
+        for (int i = 0; i < OPS; ++i) {
+            sum += skip.get(rng() % skip.getSize());
+        }
+        double skip_get_time = timer.stop();
+        print_result("Skip Random Get" + suffix, skip_get_time, OPS);
+
+        timer.start();
+        for (int i = 0; i < OPS; ++i) {
+            skip.remove(rng() % skip.getSize());
+        }
+        double skip_remove_time = timer.stop();
+        print_result("Skip Random Remove" + suffix, skip_remove_time, OPS);
+
+        if (n > 100000) continue;
+
+        DoubleList<int> list;
+        for (int i = 0; i < n; ++i) {
+            list.pushBack(i);
+        }
+        timer.start();
+        for (int i = 0; i < OPS; ++i) {
+            list.insert(rng() % (list.getSize() + 1), i);
+        }
+        double list_insert_time = timer.stop();
+        print_result("DoubleList Random Insert" + suffix, list_insert_time, OPS);
+
+        timer.start();
+        for (int i = 0; i < OPS; ++i) {
+            sum += list.get(rng() % list.getSize());
+        }
+        double list_get_time = timer.stop();
+        print_result("DoubleList Random Get" + suffix, list_get_time, OPS);
+    }
+}
+
+/**
+ * @brief Возвращает объем памяти кучи, занятой программой.
+ * @return Байты в занятых блоках (0, если glibc не предоставляет mallinfo2).
+ */
+size_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd; // мелкие блоки + крупные блоки через mmap
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Сравнение расхода памяти и скорости XorList и DoubleList.
+ *
+ * Байты на элемент считаются по приросту занятой кучи (glibc mallinfo2), поэтому
+ * для DoubleList учитываются и служебные данные аллокатора на каждый узел.
+ */
+void benchmark_xor_list() {
+    print_header("XOR LIST");
+
+    const int N = 1000000;
+    BenchmarkTimer timer;
+    volatile long long sum = 0;
+
+    size_t before = heap_in_use();
+    DoubleList<int> list;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        list.pushBack(i);
+    }
+    double list_push_time = timer.stop();
+    size_t list_bytes = heap_in_use() - before;
+    print_result("DoubleList Push Back 1M", list_push_time, N);
+
+    timer.start();
+    for (int value : list) {
+        sum += value;
+    }
+    double list_iterate_time = timer.stop();
+    print_result("DoubleList Iterate All", list_iterate_time, N);
+
+    before = heap_in_use();
+    XorList<int> xor_list;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        xor_list.pushBack(i);
+    }
+    double xor_push_time = timer.stop();
+    size_t xor_bytes = heap_in_use() - before;
+    print_result("XorList Push Back 1M", xor_push_time, N);
+
+    timer.start();
+    for (int value : xor_list) {
+        sum += value;
+    }
+    double xor_iterate_time = timer.stop();
+    print_result("XorList Iterate All", xor_iterate_time, N);
+
+    timer.start();
+    for (auto it = xor_list.rbegin(); it != xor_list.rend(); ++it) {
+        sum += *it;
+    }
+    double xor_reverse_time = timer.stop();
+    print_result("XorList Reverse Iterate", xor_reverse_time, N);
+
+    std::ostringstream info;
+    info << std::fixed << std::setprecision(1);
+    if (list_bytes > 0) {
+        info << "Heap bytes/element: DoubleList " << static_cast<double>(list_bytes) / N
+             << ", XorList " << static_cast<double>(xor_bytes) / N;
+    } else {
+        info << "Heap statistics unavailable";
+    }
+    print_info(info.str());
+    std::ostringstream pool_info;
+    pool_info << std::fixed << std::setprecision(1) << "XorList memoryUsage(): "
+              << static_cast<double>(xor_list.memoryUsage()) / N << " bytes/element (pool capacity included)";
+    print_info(pool_info.str());
+}
+
+/**
+ * @brief Сравнение блочного Deque с DoubleList и Queue на операциях с обоими концами.
+ */
+void benchmark_deque() {
+    print_header("DEQUE");
+
+    const int N = 1000000;
+    BenchmarkTimer timer;
+    volatile long long sum = 0;
+
+    DoubleList<int> list;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        list.pushBack(i);
+    }
+    print_result("DoubleList Push Back 1M", timer.stop(), N);
+
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        list.popFront();
+    }
+    print_result("DoubleList Pop Front 1M", timer.stop(), N);
+
+    Queue<int> queue;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        queue.enqueue(i);
+    }
+    print_result("Queue Enqueue 1M", timer.stop(), N);
+
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        queue.dequeue();
+    }
+    print_result("Queue Dequeue 1M", timer.stop(), N);
+
+    Deque<int> deque;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        deque.pushBack(i);
+    }
+    print_result("Deque Push Back 1M", timer.stop(), N);
+
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        deque.popFront();
+    }
+    print_result("Deque Pop Front 1M", timer.stop(), N);
+
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        deque.pushFront(i);
+    }
+    print_result("Deque Push Front 1M", timer.stop(), N);
+
+    // Случайный доступ по индексу: у DoubleList это O(N) на запрос, поэтому сравнение не приводится
+    const int ACCESSES = 1000000;
+    timer.start();
+    size_t index = 0;
+    for (int i = 0; i < ACCESSES; ++i) {
+        index = (index + 7919) % N;
+        sum += deque.get(index);
+    }
+    print_result("Deque Random get(i)", timer.stop(), ACCESSES);
+
+    timer.start();
+    deque.forEachBlock([&sum](const int* data, size_t count) {
+        long long local = 0;
+        for (size_t i = 0; i < count; ++i) {
+            local += data[i];
+        }
+        sum += local;
+    });
+    print_result("Deque forEachBlock", timer.stop(), N);
+
+    for (int i = 0; i < N; ++i) {
+        list.pushBack(i);
+    }
+    timer.start();
+    for (int value : list) {
+        sum += value;
+    }
+    print_result("DoubleList Iterate All", timer.stop(), N);
+
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        deque.popBack();
+    }
+    print_result("Deque Pop Back 1M", timer.stop(), N);
+}
+
+/**
+ * @brief Объект из "арены" для сравнения DoubleList<T*> с интрузивным списком.
+ */
+struct ArenaObject {
+    int payload;
+    IntrusiveListHook<ArenaObject> hook;
+};
+
+/**
+ * @brief Сравнение DoubleList указателей с интрузивным двусвязным списком.
+ *
+ * Объекты заранее размещены в массиве. DoubleList<ArenaObject*> выделяет
+ * отдельный узел на каждый элемент и добавляет лишний переход по указателю;
+ * IntrusiveDoubleList хранит связи в самом объекте и удаляет его по ссылке за O(1).
+ */
+void benchmark_intrusive_list() {
+    print_header("INTRUSIVE LIST");
+
+    const int N = 100000;
+    BenchmarkTimer timer;
+    ArenaObject* arena = new ArenaObject[N];
+    for (int i = 0; i < N; ++i) {
+        arena[i].payload = i;
+    }
+
+    DoubleList<ArenaObject*> pointers;
+    NodeAllocStats::reset();
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        pointers.pushBack(&arena[i]);
+    }
+    double pointer_insert_time = timer.stop();
+    print_result("DoubleList<T*> Push Back", pointer_insert_time, N);
+    print_info("Node allocations: " + std::to_string(NodeAllocStats::allocations()));
+
+    IntrusiveDoubleList<ArenaObject, &ArenaObject::hook> intrusive;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        intrusive.pushBack(arena[i]);
+    }
+    double intrusive_insert_time = timer.stop();
+    print_result("Intrusive Push Back", intrusive_insert_time, N);
+
+    volatile long long sum = 0;
+    timer.start();
+    for (ArenaObject& object : intrusive) {
+        sum += object.payload;
+    }
+    double intrusive_iterate_time = timer.stop();
+    print_result("Intrusive Iterate All", intrusive_iterate_time, N);
+
+    // Удаление каждого второго объекта, известного по ссылке
+    timer.start();
+    pointers.removeIf([](ArenaObject* object) { return object->payload % 2 == 0; });
+    double pointer_remove_time = timer.stop();
+    print_result("DoubleList<T*> removeIf", pointer_remove_time, N / 2);
+
+    timer.start();
+    for (int i = 0; i < N; i += 2) {
+        intrusive.remove(arena[i]);
+    }
+    double intrusive_remove_time = timer.stop();
+    print_result("Intrusive Remove by Ref", intrusive_remove_time, N / 2);
+
+    intrusive.clear();
+    delete[] arena;
+}
+
+/**
+ * @brief Множество на основе ForwardList под общим мьютексом (базовый вариант).
+ */
+class MutexForwardListSet {
+private:
+    ForwardList<int> list;
+    std::mutex mutex;
+
+public:
+    bool insert(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.find(key)) return false;
+        list.pushFront(key);
+        return true;
+    }
+
+    bool remove(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return list.removeIf([key](int v) { return v == key; }) > 0;
+    }
+
+    bool find(int key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return list.find(key);
+    }
+};
+
+/**
+ * @brief Запускает смешанную нагрузку (90% find, 5% insert, 5% remove) в нескольких потоках.
+ * @return Время выполнения в миллисекундах.
+ */
+template<typename Set>
+double run_read_heavy(Set& set, int threads, int ops_per_thread, int key_range) {
+    std::vector<std::thread> workers;
+    std::atomic<int> found_count(0);
+    BenchmarkTimer timer;
+    timer.start();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&set, &found_count, t, ops_per_thread, key_range]() {
+            std::mt19937 rng(1000 + t);
+            std::uniform_int_distribution<int> key_dist(0, key_range - 1);
+            std::uniform_int_distribution<int> op_dist(0, 99);
+            int local_found = 0;
+            for (int i = 0; i < ops_per_thread; ++i) {
+                int key = key_dist(rng);
+                int op = op_dist(rng);
+                if (op < 90) {
+                    local_found += set.find(key) ? 1 : 0;
+                } else if (op < 95) {
+                    set.insert(key);
+                } else {
+                    set.remove(key);
+                }
+            }
+            found_count += local_found;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return timer.stop();
+}
+
+/**
+ * @brief Сравнение LockFreeList с ForwardList под мьютексом на нагрузке с преобладанием чтения.
+ */
+void benchmark_lock_free_list() {
+    print_header("LOCK-FREE LIST");
+
+    const int KEY_RANGE = 512;
+    const int OPS_PER_THREAD = 100000;
+    print_info("Hardware threads: " + std::to_string(std::thread::hardware_concurrency()));
+
+    for (int threads : {1, 2, 4}) {
+        MutexForwardListSet locked;
+        LockFreeList<int> lock_free;
+        for (int key = 0; key < KEY_RANGE; key += 2) {
+            locked.insert(key);
+            lock_free.insert(key);
+        }
+        int total_ops = threads * OPS_PER_THREAD;
+
+        double locked_time = run_read_heavy(locked, threads, OPS_PER_THREAD, KEY_RANGE);
+        print_result("Mutex ForwardList x" + std::to_string(threads), locked_time, total_ops);
+
+        double lock_free_time = run_read_heavy(lock_free, threads, OPS_PER_THREAD, KEY_RANGE);
+        print_result("LockFreeList x" + std::to_string(threads), lock_free_time, total_ops);
+    }
+}
+
+/**
+ * @brief DoubleList под общим мьютексом (базовый вариант для ConcurrentDeque).
+ */
+class MutexDoubleListDeque {
+private:
+    DoubleList<int> list;
+    std::mutex mutex;
+
+public:
+    void pushBack(int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.pushBack(value);
+    }
+
+    bool tryPopFront(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.isEmpty()) return false;
+        out = list.get(0);
+        list.popFront();
+        return true;
+    }
+
+    bool tryPopBack(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.isEmpty()) return false;
+        out = list.get(list.getSize() - 1);
+        list.popBack();
+        return true;
+    }
+};
+
+/**
+ * @brief Конвейер: производители добавляют в конец, потребители извлекают
+ * поочередно с начала и с конца, пока не будут извлечены все элементы.
+ * @return Время выполнения в миллисекундах.
+ */
+template<typename Deque>
+double run_pipeline(Deque& deque, int producers, int consumers, int items_per_producer) {
+    const int PREFILL = 1024; // запас, при котором обе стороны работают на быстром пути
+    for (int i = 0; i < PREFILL; ++i) {
+        deque.pushBack(i);
+    }
+    const int total = producers * items_per_producer + PREFILL;
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> workers;
+
+    BenchmarkTimer timer;
+    timer.start();
+    for (int p = 0; p < producers; ++p) {
+        workers.emplace_back([&deque, items_per_producer]() {
+            for (int i = 0; i < items_per_producer; ++i) {
+                deque.pushBack(i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        workers.emplace_back([&deque, &consumed, total, c]() {
+            int value;
+            bool from_front = c % 2 == 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                bool popped = from_front ? deque.tryPopFront(value) : deque.tryPopBack(value);
+                if (popped) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return timer.stop();
+}
+
+/**
+ * @brief Сравнение ConcurrentDeque с DoubleList под одним мьютексом при конкуренции потоков.
+ */
+void benchmark_concurrent_deque() {
+    print_header("CONCURRENT DEQUE");
+
+    const int ITEMS_PER_PRODUCER = 200000;
+    print_info("Hardware threads: " + std::to_string(std::thread::hardware_concurrency()));
+
+    for (int threads : {1, 2}) {
+        int total_ops = 2 * threads * ITEMS_PER_PRODUCER;
+        std::string suffix = " " + std::to_string(threads) + "P/" + std::to_string(2 * threads) + "C";
+
+        MutexDoubleListDeque locked;
+        double locked_time = run_pipeline(locked, threads, 2 * threads, ITEMS_PER_PRODUCER);
+        print_result("Mutex DoubleList" + suffix, locked_time, total_ops);
+
+        ConcurrentDeque<int> concurrent;
+        double concurrent_time = run_pipeline(concurrent, threads, 2 * threads, ITEMS_PER_PRODUCER);
+        print_result("ConcurrentDeque" + suffix, concurrent_time, total_ops);
+    }
+}
+
+/**
+ * @brief Сравнение сортировки списков на месте с копированием в массив.
+ *
+ * Базовый вариант копирует ForwardList в Array, сортирует std::sort и
+ * пересобирает список заново (с выделением памяти под каждый узел).
+ * ForwardList::sort и DoubleList::sort только перепривязывают узлы.
+ */
+void benchmark_list_sort() {
+    print_header("LIST SORT");
+
+    const int N = 100000;
+    BenchmarkTimer timer;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, N);
+    Array<int> source;
+    for (int i = 0; i < N; ++i) {
+        source.add(dist(rng));
+    }
+
+    ForwardList<int> copied;
+    for (int i = 0; i < N; ++i) {
+        copied.pushBack(source[i]);
+    }
+    NodeAllocStats::reset();
+    timer.start();
+    Array<int> buffer;
+    for (int value : copied) {
+        buffer.add(value);
+    }
+    std::sort(&buffer[0], &buffer[0] + buffer.getSize());
+    copied.clear();
+    for (size_t i = 0; i < buffer.getSize(); ++i) {
+        copied.pushBack(buffer[i]);
+    }
+    double copy_time = timer.stop();
+    print_result("Copy + std::sort + Rebuild", copy_time, N);
+    print_info("Node allocations: " + std::to_string(NodeAllocStats::allocations()));
+
+    ForwardList<int> flist;
+    for (int i = 0; i < N; ++i) {
+        flist.pushBack(source[i]);
+    }
+    NodeAllocStats::reset();
+    timer.start();
+    flist.sort();
+    double forward_time = timer.stop();
+    print_result("ForwardList::sort", forward_time, N);
+    print_info("Node allocations: " + std::to_string(NodeAllocStats::allocations()));
+
+    DoubleList<int> dlist;
+    for (int i = 0; i < N; ++i) {
+        dlist.pushBack(source[i]);
+    }
+    timer.start();
+    dlist.sort();
+    double double_time = timer.stop();
+    print_result("DoubleList::sort", double_time, N);
+
+    // Слияние двух отсортированных половин
+    ForwardList<int> left;
+    ForwardList<int> right;
+    for (int i = 0; i < N; i += 2) {
+        left.pushBack(i);
+        right.pushBack(i + 1);
+    }
+    timer.start();
+    left.merge(right);
+    double merge_time = timer.stop();
+    print_result("ForwardList::merge", merge_time, N);
+
+    timer.start();
+    size_t removed = flist.unique();
+    double unique_time = timer.stop();
+    print_result("ForwardList::unique", unique_time, N);
+    print_info("Duplicates removed: " + std::to_string(removed));
 }
 
 /**
@@ -286,6 +1084,213 @@ void benchmark_queue() {
     }
     double dequeue_time = timer.stop();
     print_result("Dequeue", dequeue_time, 1000);
+
+    // Передача сообщений: front() + dequeue() против перемещения tryPop()
+    Queue<std::string> messages;
+    const std::string payload(64, 'x');
+    for (int i = 0; i < N; ++i) {
+        messages.enqueue(payload);
+    }
+    timer.start();
+    size_t total = 0;
+    for (int i = 0; i < N; ++i) {
+        std::string message = messages.front();
+        messages.dequeue();
+        total += message.size();
+    }
+    double copy_pop_time = timer.stop();
+    print_result("Front+Dequeue", copy_pop_time, N);
+
+    for (int i = 0; i < N; ++i) {
+        messages.enqueue(std::string(payload));
+    }
+    timer.start();
+    std::string message;
+    while (messages.tryPop(message)) {
+        total += message.size();
+    }
+    double move_pop_time = timer.stop();
+    print_result("TryPop (move)", move_pop_time, N);
+
+    // Пакетные операции
+    Array<int> batch;
+    for (int i = 0; i < N; ++i) {
+        batch.add(i);
+    }
+    timer.start();
+    queue.enqueueRange(&batch.get(0), &batch.get(0) + N);
+    double range_time = timer.stop();
+    print_result("EnqueueRange", range_time, N);
+
+    int buffer[256];
+    int drained = 0;
+    timer.start();
+    size_t count;
+    while ((count = queue.dequeueInto(buffer, 256)) > 0) {
+        drained += static_cast<int>(count);
+    }
+    double drain_time = timer.stop();
+    print_result("DequeueInto", drain_time, drained);
+}
+
+/**
+ * @brief Моделирует оборот очереди и стека постоянного размера с заданной политикой выделения.
+ * @tparam Alloc Политика выделения узлов.
+ * @param label Название строки результата.
+ */
+template<typename Alloc>
+void run_node_churn(const std::string& label) {
+    const int N = 1000000;
+    const int WINDOW = 64;
+    BenchmarkTimer timer;
+
+    Queue<int, Alloc> queue;
+    Stack<int, Alloc> stack;
+    for (int i = 0; i < WINDOW; ++i) {
+        queue.enqueue(i);
+        stack.push(i);
+    }
+
+    NodeAllocStats::reset();
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        queue.enqueue(i);
+        queue.dequeue();
+        stack.push(i);
+        stack.pop();
+    }
+    double churn_time = timer.stop();
+    print_result(label, churn_time, N);
+    print_info("  global allocations: " + std::to_string(NodeAllocStats::allocations()) +
+               ", deallocations: " + std::to_string(NodeAllocStats::deallocations()));
+}
+
+/**
+ * @brief Сравнение политик выделения узлов (DefaultNodeAllocator и PooledNodeAllocator).
+ *
+ * Подсчитывает обращения к глобальному аллокатору при push/pop постоянного размера.
+ */
+void benchmark_node_pool() {
+    print_header("NODE POOL");
+    run_node_churn<DefaultNodeAllocator>("Churn new/delete");
+    run_node_churn<PooledNodeAllocator<>>("Churn pooled");
+}
+
+/**
+ * @brief Тестирование персистентной очереди (PersistentQueue).
+ *
+ * Сравнивает стоимость контрольной точки: полная бинарная сериализация Queue (O(N))
+ * против сброса отображённых сегментов PersistentQueue, а также время повторного открытия.
+ */
+void benchmark_persistent_queue() {
+    print_header("PERSISTENT QUEUE");
+
+    const int N = 100000;
+    const std::string dir = "benchmark_pqueue";
+    std::filesystem::remove_all(dir);
+    BenchmarkTimer timer;
+
+    {
+        PersistentQueue<int> queue(dir);
+        timer.start();
+        for (int i = 0; i < N; ++i) {
+            queue.enqueue(i);
+        }
+        double enqueue_time = timer.stop();
+        print_result("Enqueue", enqueue_time, N);
+
+        // Контрольная точка после небольшой порции новых данных
+        queue.sync();
+        for (int i = 0; i < 100; ++i) {
+            queue.enqueue(i);
+        }
+        timer.start();
+        queue.sync();
+        double sync_time = timer.stop();
+        print_result("Checkpoint", sync_time, 1);
+
+        timer.start();
+        for (int i = 0; i < N && !queue.isEmpty(); ++i) {
+            queue.dequeue();
+        }
+        double dequeue_time = timer.stop();
+        print_result("Dequeue", dequeue_time, N);
+
+        for (int i = 0; i < N; ++i) {
+            queue.enqueue(i);
+        }
+    }
+
+    timer.start();
+    {
+        PersistentQueue<int> reopened(dir);
+        volatile size_t restored = reopened.getSize();
+        (void)restored;
+    }
+    double reopen_time = timer.stop();
+    print_result("Reopen", reopen_time, 1);
+    std::filesystem::remove_all(dir);
+
+    // Базовая линия: полная сериализация обычной очереди на каждой контрольной точке
+    Queue<int> baseline;
+    for (int i = 0; i < N; ++i) {
+        baseline.enqueue(i);
+    }
+    timer.start();
+    {
+        std::ofstream out("benchmark_queue.bin", std::ios::binary);
+        baseline.serializeBinary(out);
+    }
+    double full_time = timer.stop();
+    print_result("Queue Checkpoint", full_time, 1);
+    std::remove("benchmark_queue.bin");
+}
+
+/**
+ * @brief Тестирование очереди отложенных заданий (DelayQueue).
+ *
+ * Планирует 1M таймеров со случайными сроками и пакетно извлекает готовые,
+ * продвигая текущее время.
+ */
+void benchmark_delay_queue() {
+    print_header("DELAY QUEUE");
+
+    const int N = 1000000;
+    const int BATCH = 256;
+    BenchmarkTimer timer;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint64_t> dis(0, 1000000);
+
+    DelayQueue<int> queue;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        queue.schedule(i, dis(gen));
+    }
+    double schedule_time = timer.stop();
+    print_result("Schedule", schedule_time, N);
+
+    // Проверка готовности при отсутствии наступивших сроков не перебирает очередь
+    timer.start();
+    volatile bool ready = false;
+    for (int i = 0; i < N; ++i) {
+        ready = queue.hasReady(0);
+    }
+    (void)ready;
+    double idle_time = timer.stop();
+    print_result("Idle Poll", idle_time, N);
+
+    int out[BATCH];
+    int polled = 0;
+    timer.start();
+    for (uint64_t now = 0; !queue.isEmpty(); now += 1000) {
+        size_t count;
+        while ((count = queue.pollReady(now, out, BATCH)) > 0) {
+            polled += static_cast<int>(count);
+        }
+    }
+    double poll_time = timer.stop();
+    print_result("Poll Ready", poll_time, polled);
 }
 
 /**
@@ -421,6 +1426,7 @@ void benchmark_full_binary_tree() {
     }
     double find_time = timer.stop();
     print_result("Find", find_time, N);
+    print_info("Found: " + std::to_string(found_count) + "/" + std::to_string(N));
 
     // Проверка инварианта
     timer.start();
@@ -444,6 +1450,175 @@ void benchmark_full_binary_tree() {
     }
     double remove_time = timer.stop();
     print_result("Remove", remove_time, 100);
+
+    // Хеш-индекс значений: поиск и выбор удаляемого узла без обхода
+    FullBinaryTree<int, true> indexed_tree;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        indexed_tree.insert(i);
+    }
+    print_result("Indexed Insert", timer.stop(), N);
+
+    timer.start();
+    found_count = 0;
+    for (int i = 0; i < N; ++i) {
+        if (indexed_tree.find(dis(gen))) {
+            found_count++;
+        }
+    }
+    print_result("Indexed Find", timer.stop(), N);
+    print_info("Indexed found: " + std::to_string(found_count) + "/" + std::to_string(N));
+
+    timer.start();
+    for (int i = 0; i < 100 && indexed_tree.getSize() > 0; ++i) {
+        indexed_tree.remove(i);
+    }
+    print_result("Indexed Remove", timer.stop(), 100);
+
+    // Неявное хранение: вставка без обхода в ширину и без выделения памяти на узел
+    ImplicitFullBinaryTree<int> implicit_tree;
+    timer.start();
+    for (int i = 0; i < N; ++i) {
+        implicit_tree.insert(i);
+    }
+    print_result("Implicit Insert", timer.stop(), N);
+
+    timer.start();
+    found_count = 0;
+    for (int i = 0; i < N; ++i) {
+        if (implicit_tree.find(dis(gen))) {
+            found_count++;
+        }
+    }
+    print_result("Implicit Find", timer.stop(), N);
+    print_info("Implicit found: " + std::to_string(found_count) + "/" + std::to_string(N));
+
+    timer.start();
+    for (int i = 0; i < 100 && implicit_tree.getSize() > 0; ++i) {
+        implicit_tree.remove(i);
+    }
+    print_result("Implicit Remove", timer.stop(), 100);
+
+    const int LARGE_N = 1000000;
+    ImplicitFullBinaryTree<int> large_tree;
+    timer.start();
+    for (int i = 0; i < LARGE_N; ++i) {
+        large_tree.insert(i);
+    }
+    print_result("Implicit Insert 1M", timer.stop(), LARGE_N);
+
+    // Копирование, сериализация и освобождение большого дерева без рекурсии
+    FullBinaryTree<int> large_pointer_tree;
+    timer.start();
+    for (int i = 0; i < LARGE_N / 2; ++i) {
+        large_pointer_tree.insert(i);
+    }
+    size_t nodes = large_pointer_tree.getSize();
+    print_result("Insert 1M nodes (arena)", timer.stop(), nodes);
+
+    // Обходы итераторами без стека; прежний способ — сериализация в текст и разбор
+    volatile long long traversal_sum = 0;
+    timer.start();
+    for (int value : large_pointer_tree.levelOrderRange()) traversal_sum += value;
+    print_result("Level-order iterate 1M", timer.stop(), nodes);
+
+    timer.start();
+    for (int value : large_pointer_tree.preOrderRange()) traversal_sum += value;
+    print_result("Pre-order iterate 1M", timer.stop(), nodes);
+
+    timer.start();
+    for (int value : large_pointer_tree.inOrderRange()) traversal_sum += value;
+    print_result("In-order iterate 1M", timer.stop(), nodes);
+
+    timer.start();
+    for (int value : large_pointer_tree.postOrderRange()) traversal_sum += value;
+    print_result("Post-order iterate 1M", timer.stop(), nodes);
+
+    timer.start();
+    {
+        std::stringstream text;
+        large_pointer_tree.serializeText(text);
+        std::string token;
+        while (text >> token) {
+            if (token != "null") traversal_sum += std::stoi(token);
+        }
+    }
+    print_result("Walk via serializeText 1M", timer.stop(), nodes);
+
+    timer.start();
+    FullBinaryTree<int> large_copy(large_pointer_tree);
+    print_result("Copy 1M nodes", timer.stop(), nodes);
+
+    std::stringstream snapshot;
+    timer.start();
+    large_copy.serializeBinary(snapshot);
+    print_result("Serialize Binary 1M nodes", timer.stop(), nodes);
+
+    timer.start();
+    large_copy.deserializeBinary(snapshot);
+    print_result("Deserialize Binary 1M nodes", timer.stop(), nodes);
+
+    std::stringstream succinct;
+    timer.start();
+    large_copy.serializeSuccinct(succinct);
+    print_result("Serialize Succinct 1M nodes", timer.stop(), nodes);
+
+    timer.start();
+    large_copy.deserializeSuccinct(succinct);
+    print_result("Deserialize Succinct 1M nodes", timer.stop(), nodes);
+    print_info("Bytes: binary " + std::to_string(snapshot.str().size()) +
+               ", succinct " + std::to_string(succinct.str().size()));
+
+    timer.start();
+    large_copy.clear();
+    print_result("Clear 1M nodes", timer.stop(), nodes);
+}
+
+/**
+ * @brief Ускорение параллельных обходов FullBinaryTree в зависимости от числа задач.
+ *
+ * Сбалансированное дерево из 2^24 - 1 узлов (все уровни заполнены).
+ */
+void benchmark_full_binary_tree_parallel() {
+    print_header("FULL BINARY TREE PARALLEL");
+
+    const int LEVELS = 24;
+    const size_t NODES = (size_t(1) << LEVELS) - 1;
+    BenchmarkTimer timer;
+    print_info("Hardware threads: " + std::to_string(std::thread::hardware_concurrency()));
+
+    FullBinaryTree<int> tree;
+    for (size_t i = 0; tree.getSize() < NODES; ++i) {
+        tree.insert(static_cast<int>(i));
+    }
+
+    auto to_long = [](int v) { return static_cast<long long>(v); };
+    auto plus = [](long long a, long long b) { return a + b; };
+    double base_reduce = 0, base_find = 0;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        std::string suffix = " x" + std::to_string(threads);
+
+        timer.start();
+        volatile long long sum = tree.parallelReduce(0LL, to_long, plus, threads);
+        double reduce_time = timer.stop();
+        print_result("parallelReduce sum" + suffix, reduce_time, NODES);
+        (void)sum;
+
+        timer.start();
+        volatile bool found = tree.parallelFind(-1, threads); // худший случай: значения нет
+        double find_time = timer.stop();
+        print_result("parallelFind missing" + suffix, find_time, NODES);
+        (void)found;
+
+        if (threads == 1) {
+            base_reduce = reduce_time;
+            base_find = find_time;
+        }
+        std::ostringstream info;
+        info << std::fixed << std::setprecision(2) << "Speedup" << suffix << ": reduce "
+             << base_reduce / reduce_time << "x, find " << base_find / find_time << "x";
+        print_info(info.str());
+    }
 }
 
 /**
@@ -521,10 +1696,20 @@ void print_comparison_summary() {
     std::cout << "Array             | Random access, cache-friendly operations" << std::endl;
     std::cout << "ForwardList       | Frequent front insertions, memory efficiency" << std::endl;
     std::cout << "DoubleList        | Bidirectional traversal, front/back operations" << std::endl;
+    std::cout << "UnrolledList      | Cache-friendly sequential traversal and search" << std::endl;
+    std::cout << "IndexedSkipList   | O(log n) insert/get/remove by position" << std::endl;
+    std::cout << "XorList           | Memory-compact bidirectional list" << std::endl;
+    std::cout << "Deque             | Push/pop at both ends, O(1) indexed access" << std::endl;
+    std::cout << "IntrusiveList     | Objects in several lists, O(1) unlink by reference" << std::endl;
+    std::cout << "LockFreeList      | Concurrent ordered set without locks" << std::endl;
+    std::cout << "ConcurrentDeque   | Multi-threaded push/pop at both ends" << std::endl;
     std::cout << "Queue             | FIFO operations, producer-consumer patterns" << std::endl;
+    std::cout << "PersistentQueue   | Durable FIFO buffers surviving restarts" << std::endl;
+    std::cout << "DelayQueue        | Scheduled jobs, retries and timers" << std::endl;
     std::cout << "Stack             | LIFO operations, recursion simulation" << std::endl;
     std::cout << "HashTable         | Fast key-value lookups, O(1) average access" << std::endl;
     std::cout << "FullBinaryTree    | Hierarchical data with full binary constraint" << std::endl;
+    std::cout << "ImplicitFullTree  | Level-order full tree, O(1) insert, no pointers" << std::endl;
 
     // Дублирование в файл
     if (resultsFile.is_open()) {
@@ -534,10 +1719,20 @@ void print_comparison_summary() {
         resultsFile << "Array             | Random access, cache-friendly operations" << std::endl;
         resultsFile << "ForwardList       | Frequent front insertions, memory efficiency" << std::endl;
         resultsFile << "DoubleList        | Bidirectional traversal, front/back operations" << std::endl;
+        resultsFile << "UnrolledList      | Cache-friendly sequential traversal and search" << std::endl;
+        resultsFile << "IndexedSkipList   | O(log n) insert/get/remove by position" << std::endl;
+        resultsFile << "XorList           | Memory-compact bidirectional list" << std::endl;
+        resultsFile << "Deque             | Push/pop at both ends, O(1) indexed access" << std::endl;
+        resultsFile << "IntrusiveList     | Objects in several lists, O(1) unlink by reference" << std::endl;
+        resultsFile << "LockFreeList      | Concurrent ordered set without locks" << std::endl;
+        resultsFile << "ConcurrentDeque   | Multi-threaded push/pop at both ends" << std::endl;
         resultsFile << "Queue             | FIFO operations, producer-consumer patterns" << std::endl;
+        resultsFile << "PersistentQueue   | Durable FIFO buffers surviving restarts" << std::endl;
+        resultsFile << "DelayQueue        | Scheduled jobs, retries and timers" << std::endl;
         resultsFile << "Stack             | LIFO operations, recursion simulation" << std::endl;
         resultsFile << "HashTable         | Fast key-value lookups, O(1) average access" << std::endl;
         resultsFile << "FullBinaryTree    | Hierarchical data with full binary constraint" << std::endl;
+        resultsFile << "ImplicitFullTree  | Level-order full tree, O(1) insert, no pointers" << std::endl;
     }
 }
 
@@ -561,10 +1756,22 @@ int main() {
     benchmark_array();
     benchmark_forward_list();
     benchmark_double_list();
+    benchmark_unrolled_list();
+    benchmark_indexed_skip_list();
+    benchmark_xor_list();
+    benchmark_deque();
+    benchmark_intrusive_list();
+    benchmark_lock_free_list();
+    benchmark_concurrent_deque();
+    benchmark_list_sort();
     benchmark_queue();
+    benchmark_node_pool();
+    benchmark_persistent_queue();
+    benchmark_delay_queue();
     benchmark_stack();
     benchmark_hash_table();
     benchmark_full_binary_tree();
+    benchmark_full_binary_tree_parallel();
     benchmark_serialization();
 
     print_comparison_summary();
@@ -1,13 +1,29 @@
 #include <gtest/gtest.h>
 #include <fstream>
 #include <sstream>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <vector>
+#include <limits>
 #include "Array.h"
 #include "ForwardList.h"
 #include "DoubleList.h"
+#include "UnrolledList.h"
+#include "IntrusiveList.h"
+#include "IndexedSkipList.h"
+#include "XorList.h"
+#include "Deque.h"
+#include "LockFreeList.h"
+#include "ConcurrentDeque.h"
 #include "Queue.h"
+#include "PersistentQueue.h"
+#include "DelayQueue.h"
 #include "Stack.h"
 #include "HashTable.h"
 #include "FullBinaryTree.h"
+#include "ImplicitFullBinaryTree.h"
 
 // ==============================
 // Array Tests
@@ -131,6 +147,210 @@ TEST(ForwardListTest, RemoveValue) {
     EXPECT_EQ(list.front(), 20);
 }
 
+TEST(ForwardListTest, TailMaintainedAcrossMutations) {
+    ForwardList<int> list;
+    list.pushBack(1);
+    list.pushBack(2);
+    list.pushBack(3);
+    EXPECT_EQ(list.back(), 3);
+
+    list.remove(2);
+    EXPECT_EQ(list.back(), 2);
+    list.pushBack(4);
+    EXPECT_EQ(list.get(2), 4);
+
+    list.insert(3, 5);
+    EXPECT_EQ(list.back(), 5);
+    list.removeValue(5);
+    EXPECT_EQ(list.back(), 4);
+
+    ForwardList<int> copy(list);
+    copy.pushBack(6);
+    EXPECT_EQ(copy.back(), 6);
+    EXPECT_EQ(copy.getSize(), 4);
+
+    while (!list.isEmpty()) {
+        list.popFront();
+    }
+    EXPECT_THROW(list.back(), std::runtime_error);
+    list.pushBack(7);
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST(ForwardListTest, InsertAfterIterator) {
+    ForwardList<int> list;
+    list.pushBack(1);
+    list.pushBack(3);
+    auto it = list.insertAfter(list.begin(), 2);
+    EXPECT_EQ(*it, 2);
+    it = list.insertAfter(++it, 4);
+    EXPECT_EQ(list.back(), 4);
+    EXPECT_THROW(list.insertAfter(list.end(), 5), std::out_of_range);
+
+    int expected = 1;
+    for (int value : list) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 5);
+}
+
+TEST(ForwardListTest, IteratorTraversalAndEraseAfter) {
+    ForwardList<int> list;
+    for (int i = 0; i < 6; i++) {
+        list.pushBack(i);
+    }
+    int sum = 0;
+    for (ForwardList<int>::const_iterator it = list.cbegin(); it != list.cend(); ++it) {
+        sum += *it;
+    }
+    EXPECT_EQ(sum, 15);
+
+    // Удаляем каждый второй элемент за один проход
+    for (auto it = list.begin(); it != list.end(); ) {
+        auto next = it;
+        if (++next == list.end()) break;
+        it = list.eraseAfter(it);
+    }
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.get(1), 2);
+    EXPECT_EQ(list.back(), 4);
+    EXPECT_THROW(list.eraseAfter(ForwardList<int>::const_iterator()), std::out_of_range);
+}
+
+TEST(ForwardListTest, CursorEditing) {
+    ForwardList<int> list;
+    auto cursor = list.cursor();
+    EXPECT_TRUE(cursor.isBeforeBegin());
+    EXPECT_FALSE(cursor.hasNext());
+    cursor.insertAfter(3);
+    cursor.insertAfter(1);
+    cursor.advance();
+    EXPECT_EQ(cursor.get(), 1);
+    cursor.insertAfter(2);
+    cursor.advance();
+    cursor.advance();
+    EXPECT_EQ(cursor.get(), 3);
+    EXPECT_FALSE(cursor.hasNext());
+    cursor.insertAfter(4);
+    EXPECT_EQ(list.back(), 4);
+
+    cursor.reset();
+    cursor.eraseAfter();
+    EXPECT_EQ(list.front(), 2);
+    cursor.advance();
+    EXPECT_EQ(cursor.peekNext(), 3);
+    cursor.eraseAfter();
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list.back(), 4);
+    cursor.advance();
+    EXPECT_THROW(cursor.eraseAfter(), std::out_of_range);
+    EXPECT_THROW(cursor.advance(), std::out_of_range);
+}
+
+TEST(ForwardListTest, SortMergeUnique) {
+    ForwardList<int> list;
+    int values[] = {5, 1, 4, 1, 3, 9, 2, 6, 5, 3};
+    for (int v : values) list.pushBack(v);
+    list.sort();
+    int expected[] = {1, 1, 2, 3, 3, 4, 5, 5, 6, 9};
+    size_t i = 0;
+    for (int v : list) EXPECT_EQ(v, expected[i++]);
+    EXPECT_EQ(list.back(), 9);
+
+    ForwardList<int> other;
+    other.pushBack(0);
+    other.pushBack(7);
+    other.pushBack(10);
+    list.merge(other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.getSize(), 13);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 10);
+
+    EXPECT_EQ(list.unique(), 3);
+    EXPECT_EQ(list.getSize(), 10);
+    EXPECT_EQ(list.get(7), 7);
+    list.pushBack(11);
+    EXPECT_EQ(list.back(), 11);
+}
+
+TEST(ForwardListTest, SpliceWithoutAllocation) {
+    ForwardList<int> list;
+    ForwardList<int> other;
+    for (int i = 0; i < 3; i++) list.pushBack(i);
+    for (int i = 10; i < 15; i++) other.pushBack(i);
+
+    NodeAllocStats::reset();
+    auto first = other.cbegin();   // 10
+    auto last = first;
+    ++last; ++last; ++last;        // 13
+    list.spliceAfter(list.cbegin(), other, first, last); // переносит 11, 12
+    EXPECT_EQ(list.getSize(), 5);
+    EXPECT_EQ(other.getSize(), 3);
+    EXPECT_EQ(list.get(1), 11);
+    EXPECT_EQ(list.get(2), 12);
+    EXPECT_EQ(other.get(1), 13);
+
+    list.spliceBack(other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.getSize(), 8);
+    EXPECT_EQ(list.back(), 14);
+    EXPECT_EQ(NodeAllocStats::allocations(), 0);
+    EXPECT_EQ(NodeAllocStats::deallocations(), 0);
+}
+
+TEST(ForwardListTest, SpliceWithinSameList) {
+    ForwardList<int> list;
+    for (int i = 0; i < 6; i++) list.pushBack(i);
+
+    auto first = list.cbegin();    // 0
+    auto last = first;
+    ++last; ++last; ++last;        // 3
+    auto pos = last;
+    ++pos; ++pos;                  // 5 (хвост)
+    list.spliceAfter(pos, list, first, last); // переносит 1, 2 в конец
+    EXPECT_EQ(list.getSize(), 6);
+    EXPECT_EQ(list.get(1), 3);
+    EXPECT_EQ(list.get(3), 5);
+    EXPECT_EQ(list.back(), 2);
+    list.pushBack(6);
+    EXPECT_EQ(list.get(6), 6);
+
+    auto inside = list.cbegin();
+    ++inside; ++inside;            // 4 лежит в интервале (0, end)
+    EXPECT_THROW(list.spliceAfter(inside, list, list.cbegin(), list.cend()), std::out_of_range);
+    EXPECT_EQ(list.getSize(), 7);
+    EXPECT_EQ(list.back(), 6);
+}
+
+TEST(ForwardListTest, RemoveIfAndPartition) {
+    ForwardList<int, PooledNodeAllocator<>> list;
+    for (int i = 0; i < 10; i++) list.pushBack(i);
+
+    NodeAllocStats::reset();
+    EXPECT_EQ(list.removeIf([](int v) { return v % 3 == 0; }), 4); // 0, 3, 6, 9
+    EXPECT_EQ(list.getSize(), 6);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 8);
+    EXPECT_EQ(NodeAllocStats::deallocations(), 0); // узлы ушли в пул
+
+    ForwardList<int, PooledNodeAllocator<>> odd;
+    EXPECT_EQ(list.partition([](int v) { return v % 2 == 0; }, odd), 3);
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.get(1), 4);
+    EXPECT_EQ(list.back(), 8);
+    EXPECT_EQ(odd.getSize(), 3);
+    EXPECT_EQ(odd.front(), 1);
+    EXPECT_EQ(odd.back(), 7);
+    EXPECT_EQ(NodeAllocStats::allocations(), 0);
+
+    EXPECT_EQ(odd.removeIf([](int) { return true; }), 3);
+    EXPECT_TRUE(odd.isEmpty());
+    odd.pushBack(42);
+    EXPECT_EQ(odd.back(), 42);
+}
+
 // ==============================
 // DoubleList Tests
 // ==============================
@@ -164,6 +384,735 @@ TEST(DoubleListTest, ReverseTraversal) {
     EXPECT_EQ(list.get(2), 3);
 }
 
+TEST(DoubleListTest, SortMergeAndSplice) {
+    DoubleList<int> list;
+    for (int i = 9; i >= 0; i--) list.pushBack(i % 5);
+    list.sort();
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 4);
+    EXPECT_EQ(list.get(8), 4);  // обход с хвоста использует восстановленные prev
+    EXPECT_EQ(list.unique(), 5);
+    EXPECT_EQ(list.getSize(), 5);
+
+    DoubleList<int> other;
+    other.pushBack(2);
+    other.pushBack(8);
+    list.merge(other);
+    EXPECT_EQ(list.getSize(), 7);
+    EXPECT_EQ(list.get(3), 2);
+    EXPECT_EQ(list.back(), 8);
+
+    DoubleList<int> middle;
+    middle.pushBack(100);
+    middle.pushBack(101);
+    list.splice(6, middle);
+    EXPECT_TRUE(middle.isEmpty());
+    EXPECT_EQ(list.getSize(), 9);
+    EXPECT_EQ(list.get(6), 100);
+    EXPECT_EQ(list.get(7), 101);
+    EXPECT_EQ(list.back(), 8);
+    list.popBack();
+    EXPECT_EQ(list.back(), 101);
+    EXPECT_THROW(list.splice(20, middle), std::out_of_range);
+}
+
+TEST(DoubleListTest, RemoveIfAndPartition) {
+    DoubleList<int> list;
+    for (int i = 0; i < 10; i++) list.pushBack(i);
+    list.removeValue(9);
+    EXPECT_EQ(list.removeIf([](int v) { return v < 2 || v == 5; }), 3);
+    EXPECT_EQ(list.getSize(), 6);
+    EXPECT_EQ(list.front(), 2);
+    EXPECT_EQ(list.back(), 8);
+
+    DoubleList<int> rejected;
+    EXPECT_EQ(list.partition([](int v) { return v > 4; }, rejected), 3);
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.front(), 6);
+    EXPECT_EQ(rejected.getSize(), 3);
+    EXPECT_EQ(rejected.get(2), 4);  // обход с хвоста проверяет prev
+    rejected.popBack();
+    EXPECT_EQ(rejected.back(), 3);
+    EXPECT_THROW(list.removeIf([](int v) -> bool { if (v == 7) throw std::runtime_error("stop"); return v == 6; }),
+                 std::runtime_error);
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list.front(), 7);
+}
+
+TEST(DoubleListTest, FingerFollowsMutations) {
+    DoubleList<int> list;
+    for (int i = 0; i < 100; i++) list.pushBack(i);
+    EXPECT_EQ(list.get(40), 40);  // палец на 40
+    list.pushFront(-1);           // индексы сдвигаются на 1
+    EXPECT_EQ(list.get(41), 40);
+    list.insert(41, 1000);        // палец на новом узле
+    EXPECT_EQ(list.get(41), 1000);
+    EXPECT_EQ(list.get(42), 40);
+    list.remove(41);              // палец на следующем узле
+    EXPECT_EQ(list.get(41), 40);
+    list.popFront();
+    EXPECT_EQ(list.get(40), 40);
+    EXPECT_EQ(list.get(39), 39);
+
+    DoubleList<int> front;
+    front.pushBack(-2);
+    front.pushBack(-1);
+    list.splice(0, front);
+    EXPECT_EQ(list.get(41), 39);
+    list.removeIf([](int v) { return v < 0; });
+    EXPECT_EQ(list.get(39), 39);
+    list.sort();
+    EXPECT_EQ(list.get(99), 99);
+    list.popBack();
+    EXPECT_THROW(list.get(99), std::out_of_range);
+    EXPECT_EQ(list.get(98), 98);
+}
+
+TEST(DoubleListTest, SequentialIndexedPassMatchesArray) {
+    DoubleList<int> list;
+    Array<int> reference;
+    for (int i = 0; i < 1000; i++) {
+        list.pushBack(i);
+        reference.add(i);
+    }
+    for (size_t i = 0; i < list.getSize(); i += 3) {
+        list.remove(i);
+        reference.remove(i);
+        list.insert(i, -static_cast<int>(i));
+        reference.insert(i, -static_cast<int>(i));
+    }
+    ASSERT_EQ(list.getSize(), reference.getSize());
+    for (size_t i = 0; i < list.getSize(); i++) {
+        EXPECT_EQ(list.get(i), reference.get(i));
+    }
+    const DoubleList<int>& constList = list;
+    EXPECT_EQ(constList.get(0), list.front());
+    EXPECT_EQ(constList.get(list.getSize() - 1), list.back());
+}
+
+TEST(DoubleListTest, ConcurrentConstReads) {
+    DoubleList<int> list;
+    for (int i = 0; i < 2000; i++) list.pushBack(i);
+    const DoubleList<int>& shared = list;
+
+    // Константный get не переставляет палец, поэтому потоки не пишут общее состояние
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++) {
+        readers.emplace_back([&shared, &mismatches, t]() {
+            for (size_t i = t; i < shared.getSize(); i += 7) {
+                if (shared.get(i) != static_cast<int>(i)) mismatches++;
+            }
+        });
+    }
+    for (auto& reader : readers) reader.join();
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(list.get(1000), 1000);
+}
+
+TEST(DoubleListTest, BidirectionalAndReverseIterators) {
+    DoubleList<int> list;
+    for (int i = 1; i <= 5; i++) list.pushBack(i);
+
+    int sum = 0;
+    for (int v : list) sum += v;
+    EXPECT_EQ(sum, 15);
+
+    int expected = 5;
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+        EXPECT_EQ(*it, expected--);
+    }
+    auto last = list.end();
+    --last;
+    EXPECT_EQ(*last, 5);
+    --last;
+    EXPECT_EQ(*last, 4);
+
+    const DoubleList<int>& constList = list;
+    EXPECT_EQ(*constList.crbegin(), 5);
+    EXPECT_EQ(std::distance(constList.begin(), constList.end()), 5);
+    for (auto& v : list) v *= 10;
+    EXPECT_EQ(list.get(2), 30);
+}
+
+TEST(DoubleListTest, IteratorInsertEraseAndSplice) {
+    DoubleList<int> list;
+    for (int i = 0; i < 6; i++) list.pushBack(i);
+    EXPECT_EQ(list.get(3), 3); // палец на 3 должен сброситься при правке по итератору
+
+    // Удаляем четные элементы за один проход
+    for (auto it = list.begin(); it != list.end();) {
+        if (*it % 2 == 0) it = list.erase(it);
+        else ++it;
+    }
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.get(1), 3);
+
+    auto it = list.insert(list.begin(), -1);
+    EXPECT_EQ(*it, -1);
+    list.insert(list.end(), 100);
+    EXPECT_EQ(list.back(), 100);
+    EXPECT_EQ(list.get(3), 5);
+    EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+
+    DoubleList<int> other;
+    for (int i = 10; i < 15; i++) other.pushBack(i);
+    auto first = other.begin();
+    ++first;                      // 11
+    auto stop = first;
+    ++stop; ++stop;               // 13
+    auto pos = list.end();
+    --pos;                        // перед 100
+    list.splice(pos, other, first, stop);
+    EXPECT_EQ(list.getSize(), 7);
+    EXPECT_EQ(other.getSize(), 3);
+    EXPECT_EQ(list.get(4), 11);
+    EXPECT_EQ(list.get(5), 12);
+    EXPECT_EQ(other.get(1), 13);
+
+    list.splice(list.begin(), other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.front(), 10);
+    EXPECT_EQ(list.getSize(), 10);
+    EXPECT_EQ(*list.rbegin(), 100);
+}
+
+// ==============================
+// IndexedSkipList Tests
+// ==============================
+TEST(IndexedSkipListTest, PositionalOperationsMatchArray) {
+    IndexedSkipList<int> list;
+    Array<int> reference;
+    std::mt19937 rng(123);
+    for (int step = 0; step < 3000; step++) {
+        int op = static_cast<int>(rng() % 4);
+        if (op < 3 || reference.getSize() == 0) {
+            size_t index = rng() % (reference.getSize() + 1);
+            list.insert(index, step);
+            reference.insert(index, step);
+        } else {
+            size_t index = rng() % reference.getSize();
+            list.remove(index);
+            reference.remove(index);
+        }
+    }
+    ASSERT_EQ(list.getSize(), reference.getSize());
+    for (size_t i = 0; i < reference.getSize(); i++) {
+        EXPECT_EQ(list.get(i), reference.get(i));
+    }
+    EXPECT_EQ(list.front(), reference.get(0));
+    EXPECT_EQ(list.back(), reference.get(reference.getSize() - 1));
+    EXPECT_GT(list.getLevelCount(), 1);
+}
+
+TEST(IndexedSkipListTest, FrontBackCopyAndSerialization) {
+    IndexedSkipList<int> list;
+    EXPECT_THROW(list.popFront(), std::runtime_error);
+    EXPECT_THROW(list.back(), std::runtime_error);
+    list.pushBack(2);
+    list.pushFront(1);
+    list.pushBack(3);
+    list.popBack();
+    EXPECT_EQ(list.back(), 2);
+    list.popFront();
+    list.popFront();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(list.back(), std::runtime_error);
+
+    for (int i = 0; i < 50; i++) list.pushBack(i * 10);
+    IndexedSkipList<int> copy(list);
+    copy.remove(0);
+    EXPECT_EQ(list.get(0), 0);
+    EXPECT_EQ(copy.get(0), 10);
+    EXPECT_TRUE(copy.find(490));
+    EXPECT_THROW(copy.get(49), std::out_of_range);
+    EXPECT_THROW(copy.insert(51, 0), std::out_of_range);
+
+    std::stringstream ss;
+    list.serialize(ss);
+    IndexedSkipList<int> restored;
+    restored.deserialize(ss);
+    EXPECT_EQ(restored.getSize(), 50);
+    EXPECT_EQ(restored.get(25), 250);
+    restored = copy;
+    EXPECT_EQ(restored.getSize(), 49);
+    EXPECT_EQ(restored.back(), 490);
+}
+
+// ==============================
+// XorList Tests
+// ==============================
+TEST(XorListTest, BothEndsAndBidirectionalTraversal) {
+    XorList<int> list;
+    for (int i = 1; i <= 5; i++) list.pushBack(i);
+    list.pushFront(0);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 5);
+
+    int expected = 0;
+    for (int v : list) EXPECT_EQ(v, expected++);
+    expected = 5;
+    for (auto it = list.rbegin(); it != list.rend(); ++it) EXPECT_EQ(*it, expected--);
+
+    list.insert(3, 100);
+    EXPECT_EQ(list.get(3), 100);
+    EXPECT_EQ(list.get(4), 3);
+    list.remove(4);           // удаление ближе к хвосту
+    list.remove(1);           // удаление ближе к голове
+    EXPECT_EQ(list.getSize(), 5);
+    EXPECT_EQ(list.get(1), 2);
+    EXPECT_EQ(list.get(2), 100);
+    list.popFront();
+    list.popBack();
+    EXPECT_EQ(list.front(), 2);
+    EXPECT_EQ(list.back(), 4);
+    EXPECT_THROW(list.get(3), std::out_of_range);
+}
+
+TEST(XorListTest, PoolReuseCopyAndIndexLimit) {
+    XorList<int> list;
+    for (int i = 0; i < 100; i++) list.pushBack(i);
+    size_t memory = list.memoryUsage();
+    for (int i = 0; i < 50; i++) list.popFront();
+    for (int i = 0; i < 50; i++) list.pushFront(i);
+    EXPECT_EQ(list.memoryUsage(), memory); // освобожденные узлы переиспользованы
+
+    XorList<int> copy(list);
+    copy.popBack();
+    EXPECT_EQ(list.back(), 99);
+    EXPECT_EQ(copy.back(), 98);
+    EXPECT_TRUE(copy.find(49));
+
+    std::stringstream ss;
+    copy.serializeText(ss);
+    XorList<int> restored;
+    restored.deserializeText(ss);
+    EXPECT_EQ(restored.getSize(), 99);
+    EXPECT_EQ(restored.get(0), 49);
+
+    XorList<int, uint8_t> tiny;
+    for (int i = 0; i < 255; i++) tiny.pushBack(i);
+    EXPECT_THROW(tiny.pushBack(0), std::runtime_error);
+    tiny.popFront();
+    tiny.pushBack(7);
+    EXPECT_EQ(tiny.back(), 7);
+}
+
+// ==============================
+// Deque Tests
+// ==============================
+TEST(DequeTest, MixedEndsMatchDoubleList) {
+    Deque<int, 4> deque; // маленький блок, чтобы чаще пересекать границы блоков и карты
+    DoubleList<int> reference;
+    std::mt19937 rng(7);
+    for (int step = 0; step < 2000; step++) {
+        int op = rng() % 5;
+        if (op == 0 || op == 1) {
+            deque.pushBack(step);
+            reference.pushBack(step);
+        } else if (op == 2) {
+            deque.pushFront(step);
+            reference.pushFront(step);
+        } else if (!reference.isEmpty()) {
+            if (op == 3) { deque.popFront(); reference.popFront(); }
+            else { deque.popBack(); reference.popBack(); }
+        }
+        ASSERT_EQ(deque.getSize(), reference.getSize());
+    }
+    for (size_t i = 0; i < reference.getSize(); i++) {
+        EXPECT_EQ(deque.get(i), reference.get(i));
+    }
+    EXPECT_EQ(deque.front(), reference.get(0));
+    EXPECT_EQ(deque.back(), reference.get(reference.getSize() - 1));
+
+    while (!deque.isEmpty()) deque.popFront();
+    EXPECT_THROW(deque.popBack(), std::runtime_error);
+    EXPECT_THROW(deque.front(), std::runtime_error);
+    EXPECT_THROW(deque.get(0), std::out_of_range);
+    deque.pushFront(1);
+    deque.pushBack(2);
+    EXPECT_EQ(deque.get(0), 1);
+    EXPECT_EQ(deque.get(1), 2);
+}
+
+TEST(DequeTest, BlockTraversalCopyAndSerialization) {
+    Deque<int, 8> deque;
+    for (int i = 0; i < 20; i++) deque.pushBack(i);
+    for (int i = 1; i <= 5; i++) deque.pushFront(-i);
+
+    int expected = -5;
+    size_t chunks = 0;
+    deque.forEachBlock([&](const int* data, size_t count) {
+        EXPECT_LE(count, 8u);
+        for (size_t i = 0; i < count; i++) EXPECT_EQ(data[i], expected++);
+        chunks++;
+    });
+    EXPECT_EQ(expected, 20);
+    EXPECT_GE(chunks, 4u);
+
+    Deque<int, 8> copy(deque);
+    copy.popFront();
+    copy[0] = 42;
+    EXPECT_EQ(deque.front(), -5);
+    EXPECT_EQ(copy.front(), 42);
+    EXPECT_TRUE(copy.find(19));
+    EXPECT_FALSE(copy.find(-5));
+
+    int sum = 0;
+    for (int v : copy) sum += v;
+    EXPECT_EQ(sum, 42 - 3 - 2 - 1 + 190);
+    EXPECT_EQ(copy.end() - copy.begin(), 24);
+
+    std::stringstream binary;
+    copy.serializeBinary(binary);
+    Deque<int, 8> restored;
+    restored.deserializeBinary(binary);
+    EXPECT_EQ(restored.getSize(), 24);
+    EXPECT_EQ(restored.get(23), 19);
+
+    std::stringstream text;
+    deque.serializeText(text);
+    restored.deserializeText(text);
+    EXPECT_EQ(restored.getSize(), 25);
+    EXPECT_EQ(restored.front(), -5);
+}
+
+// ==============================
+// IntrusiveList Tests
+// ==============================
+namespace {
+// Объект, одновременно состоящий в нескольких интрузивных списках
+struct Task {
+    int id;
+    IntrusiveListHook<Task> allHook;
+    IntrusiveListHook<Task> readyHook;
+    IntrusiveForwardHook<Task> freeHook;
+    explicit Task(int i = 0) : id(i) {}
+};
+using AllTasks = IntrusiveDoubleList<Task, &Task::allHook>;
+using ReadyTasks = IntrusiveDoubleList<Task, &Task::readyHook>;
+using FreeTasks = IntrusiveForwardList<Task, &Task::freeHook>;
+}
+
+TEST(IntrusiveListTest, ObjectInSeveralListsWithO1Remove) {
+    Task tasks[5] = {Task(0), Task(1), Task(2), Task(3), Task(4)};
+    AllTasks all;
+    ReadyTasks ready;
+    NodeAllocStats::reset();
+    for (Task& t : tasks) {
+        all.pushBack(t);
+        if (t.id % 2 == 0) ready.pushFront(t);
+    }
+    EXPECT_EQ(all.getSize(), 5);
+    EXPECT_EQ(ready.getSize(), 3);
+    EXPECT_EQ(ready.front().id, 4);
+
+    all.remove(tasks[2]);
+    EXPECT_FALSE(AllTasks::isLinked(tasks[2]));
+    EXPECT_TRUE(ReadyTasks::isLinked(tasks[2]));
+    EXPECT_EQ(all.getSize(), 4);
+    ready.remove(tasks[4]);
+    EXPECT_EQ(ready.front().id, 2);
+    EXPECT_EQ(ready.back().id, 0);
+
+    all.insertBefore(tasks[3], tasks[2]);
+    int expected[] = {0, 1, 2, 3, 4};
+    int i = 0;
+    for (Task& t : all) EXPECT_EQ(t.id, expected[i++]);
+    EXPECT_EQ(all.popBack().id, 4);
+    EXPECT_THROW(all.pushBack(tasks[0]), std::runtime_error);
+    EXPECT_THROW(all.remove(tasks[4]), std::runtime_error);
+    EXPECT_EQ(NodeAllocStats::allocations(), 0);
+}
+
+TEST(IntrusiveListTest, ForwardListAndClearResetsHooks) {
+    Task tasks[3] = {Task(0), Task(1), Task(2)};
+    FreeTasks free;
+    free.pushBack(tasks[0]);
+    free.pushBack(tasks[2]);
+    free.insertAfter(tasks[0], tasks[1]);
+    EXPECT_EQ(free.back().id, 2);
+    EXPECT_TRUE(free.remove(tasks[2]));
+    EXPECT_EQ(free.back().id, 1);
+    EXPECT_FALSE(free.remove(tasks[2]));
+    EXPECT_EQ(free.popFront().id, 0);
+    free.clear();
+    EXPECT_TRUE(free.isEmpty());
+    EXPECT_FALSE(FreeTasks::isLinked(tasks[1]));
+    EXPECT_THROW(free.front(), std::runtime_error);
+    {
+        FreeTasks scoped;
+        scoped.pushFront(tasks[1]);
+    }
+    EXPECT_FALSE(FreeTasks::isLinked(tasks[1]));
+}
+
+TEST(IntrusiveListTest, ForeignObjectIsRejected) {
+    Task tasks[4] = {Task(0), Task(1), Task(2), Task(3)};
+    AllTasks first;
+    AllTasks second;
+    first.pushBack(tasks[0]);
+    first.pushBack(tasks[1]);
+    second.pushBack(tasks[2]);
+
+    // Объект связан через то же звено, но в другом списке
+    EXPECT_THROW(first.remove(tasks[2]), std::runtime_error);
+    EXPECT_THROW(first.insertBefore(tasks[2], tasks[3]), std::runtime_error);
+    EXPECT_FALSE(AllTasks::isLinked(tasks[3]));
+    EXPECT_EQ(first.getSize(), 2);
+    EXPECT_EQ(second.getSize(), 1);
+    EXPECT_EQ(second.front().id, 2);
+
+    FreeTasks free_a;
+    FreeTasks free_b;
+    free_a.pushBack(tasks[0]);
+    free_b.pushBack(tasks[1]);
+    EXPECT_FALSE(free_a.remove(tasks[1]));
+    EXPECT_THROW(free_a.insertAfter(tasks[1], tasks[2]), std::runtime_error);
+    EXPECT_EQ(free_b.getSize(), 1);
+    EXPECT_TRUE(FreeTasks::isLinked(tasks[1]));
+}
+
+// ==============================
+// LockFreeList Tests
+// ==============================
+TEST(LockFreeListTest, OrderedSetSemantics) {
+    LockFreeList<int> list;
+    EXPECT_TRUE(list.insert(5));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_FALSE(list.insert(3));
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_TRUE(list.find(1));
+    EXPECT_FALSE(list.find(2));
+
+    EXPECT_TRUE(list.remove(3));
+    EXPECT_FALSE(list.remove(3));
+    EXPECT_FALSE(list.find(3));
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_EQ(list.getSize(), 3);
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_FALSE(list.find(5));
+}
+
+TEST(LockFreeListTest, ConcurrentInsertRemoveFind) {
+    LockFreeList<int> list;
+    const int THREADS = 4;
+    const int PER_THREAD = 1000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; t++) {
+        workers.emplace_back([&list, t]() {
+            // Каждый поток вставляет свой диапазон и удаляет из него нечетные ключи
+            for (int i = 0; i < PER_THREAD; i++) {
+                list.insert(t * PER_THREAD + i);
+            }
+            for (int i = 1; i < PER_THREAD; i += 2) {
+                list.remove(t * PER_THREAD + i);
+            }
+            for (int i = 0; i < PER_THREAD; i++) {
+                list.find((t + 1) % THREADS * PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    EXPECT_EQ(list.getSize(), static_cast<size_t>(THREADS * PER_THREAD / 2));
+    for (int key = 0; key < THREADS * PER_THREAD; key++) {
+        EXPECT_EQ(list.find(key), key % 2 == 0) << "key " << key;
+    }
+}
+
+// ==============================
+// ConcurrentDeque Tests
+// ==============================
+TEST(ConcurrentDequeTest, BothEndsAcrossFastAndSlowPaths) {
+    ConcurrentDeque<int> deque;
+    int value = 0;
+    EXPECT_FALSE(deque.tryPopFront(value));
+    EXPECT_FALSE(deque.tryPopBack(value));
+
+    deque.pushBack(2);   // медленный путь: очередь пуста
+    deque.pushFront(1);
+    for (int i = 3; i <= 6; i++) deque.pushBack(i); // быстрый путь
+    EXPECT_EQ(deque.getSize(), 6);
+
+    // Извлечение с чередованием концов проходит через оба пути
+    int expected_front = 1, expected_back = 6;
+    while (!deque.isEmpty()) {
+        ASSERT_TRUE(deque.tryPopFront(value));
+        EXPECT_EQ(value, expected_front++);
+        if (deque.tryPopBack(value)) {
+            EXPECT_EQ(value, expected_back--);
+        }
+    }
+    EXPECT_EQ(expected_front, expected_back + 1);
+    EXPECT_FALSE(deque.tryPopBack(value));
+
+    deque.pushFront(7);
+    deque.clear();
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+TEST(ConcurrentDequeTest, ProducersAndConsumersAtBothEnds) {
+    ConcurrentDeque<int> deque;
+    const int PRODUCERS = 2, PER_PRODUCER = 20000;
+    std::atomic<int> produced_done{0};
+    std::atomic<long long> consumed_sum{0};
+    std::atomic<int> consumed_count{0};
+
+    std::vector<std::thread> workers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        workers.emplace_back([&, p]() {
+            for (int i = 1; i <= PER_PRODUCER; i++) {
+                if (p == 0) deque.pushBack(i);
+                else deque.pushFront(i);
+            }
+            produced_done.fetch_add(1);
+        });
+    }
+    for (int c = 0; c < 2; c++) {
+        workers.emplace_back([&, c]() {
+            int value;
+            while (true) {
+                bool finished = produced_done.load() == PRODUCERS; // до попытки извлечения
+                bool popped = c == 0 ? deque.tryPopFront(value) : deque.tryPopBack(value);
+                if (popped) {
+                    consumed_sum.fetch_add(value);
+                    consumed_count.fetch_add(1);
+                } else if (finished) {
+                    break;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    long long expected_sum = static_cast<long long>(PRODUCERS) * PER_PRODUCER * (PER_PRODUCER + 1) / 2;
+    EXPECT_EQ(consumed_count.load(), PRODUCERS * PER_PRODUCER);
+    EXPECT_EQ(consumed_sum.load(), expected_sum);
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+// ==============================
+// UnrolledList Tests
+// ==============================
+TEST(UnrolledListTest, FrontBackOperations) {
+    UnrolledList<int, 4> list;
+    for (int i = 0; i < 10; i++) {
+        list.pushBack(i);
+    }
+    list.pushFront(-1);
+    EXPECT_EQ(list.getSize(), 11);
+    EXPECT_EQ(list.front(), -1);
+    EXPECT_EQ(list.back(), 9);
+    EXPECT_EQ(list.get(5), 4);
+
+    list.popFront();
+    list.popBack();
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 8);
+    EXPECT_TRUE(list.find(8));
+    EXPECT_FALSE(list.find(9));
+}
+
+TEST(UnrolledListTest, MiddleInsertRemoveMatchesDoubleList) {
+    UnrolledList<int, 4> list;
+    DoubleList<int> reference;
+    unsigned seed = 7;
+    for (int step = 0; step < 2000; step++) {
+        seed = seed * 1103515245 + 12345;
+        size_t size = reference.getSize();
+        if (size == 0 || seed % 3 != 0) {
+            size_t index = size == 0 ? 0 : (seed >> 8) % (size + 1);
+            list.insert(index, step);
+            reference.insert(index, step);
+        } else {
+            size_t index = (seed >> 8) % size;
+            list.remove(index);
+            reference.remove(index);
+        }
+    }
+    ASSERT_EQ(list.getSize(), reference.getSize());
+    for (size_t i = 0; i < reference.getSize(); i++) {
+        EXPECT_EQ(list.get(i), reference.get(i));
+    }
+    EXPECT_LE(list.getNodeCount(), list.getSize());
+}
+
+TEST(UnrolledListTest, RemoveValueAndSerialization) {
+    UnrolledList<int, 4> list;
+    for (int i = 0; i < 20; i++) {
+        list.pushBack(i % 3);
+    }
+    list.removeValue(1);
+    EXPECT_EQ(list.getSize(), 13);
+    EXPECT_FALSE(list.find(1));
+
+    std::stringstream ss;
+    list.serialize(ss);
+    UnrolledList<int, 8> copy;
+    copy.deserialize(ss);
+    EXPECT_EQ(copy.getSize(), 13);
+    EXPECT_EQ(copy.get(1), 2);
+    EXPECT_THROW(copy.get(13), std::out_of_range);
+}
+
+TEST(UnrolledListTest, IteratorAndBlockTraversal) {
+    UnrolledList<int, 4> list;
+    for (int i = 0; i < 10; i++) list.pushBack(i);
+    list.insert(2, 100); // разделяет первый узел
+
+    std::vector<int> seen;
+    for (int value : list) seen.push_back(value);
+    std::vector<int> expected = {0, 1, 100, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(seen, expected);
+
+    size_t blocks = 0;
+    std::vector<int> by_block;
+    list.forEachBlock([&](const int* data, size_t count) {
+        blocks++;
+        by_block.insert(by_block.end(), data, data + count);
+    });
+    EXPECT_EQ(by_block, expected);
+    EXPECT_EQ(blocks, list.getNodeCount());
+
+    for (int& value : list) value *= 2;
+    EXPECT_EQ(list.get(2), 200);
+    const UnrolledList<int, 4>& view = list;
+    EXPECT_EQ(*view.begin(), 0);
+    UnrolledList<int, 4> empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(UnrolledListTest, ThrowingCopyLeavesListUnchanged) {
+    struct Fragile {
+        int value = 0;
+        bool poisoned = false;
+        Fragile() = default;
+        Fragile(int v, bool p = false) : value(v), poisoned(p) {}
+        Fragile(const Fragile& other) : value(other.value), poisoned(other.poisoned) {
+            if (poisoned) throw std::runtime_error("copy failed");
+        }
+        Fragile& operator=(const Fragile& other) {
+            if (other.poisoned) throw std::runtime_error("copy failed");
+            value = other.value;
+            return *this;
+        }
+        Fragile(Fragile&&) noexcept = default;
+        Fragile& operator=(Fragile&&) noexcept = default;
+    };
+    UnrolledList<Fragile, 4> list;
+    for (int i = 0; i < 4; i++) list.pushBack(Fragile(i));
+    EXPECT_THROW(list.pushBack(Fragile(9, true)), std::runtime_error);
+    EXPECT_THROW(list.pushFront(Fragile(9, true)), std::runtime_error);
+    EXPECT_THROW(list.insert(2, Fragile(9, true)), std::runtime_error);
+    EXPECT_EQ(list.getSize(), 4);
+    EXPECT_EQ(list.getNodeCount(), 1);
+    int expected = 0;
+    for (const Fragile& item : list) EXPECT_EQ(item.value, expected++);
+}
+
 // ==============================
 // Queue Tests
 // ==============================
@@ -198,6 +1147,211 @@ TEST(QueueTest, Clear) {
     EXPECT_THROW(queue.front(), std::runtime_error);
 }
 
+namespace {
+// Тип для подсчета копирований при передаче через очередь
+struct CopyCounter {
+    static int copies;
+    int value;
+    CopyCounter(int v = 0) : value(v) {}
+    CopyCounter(const CopyCounter& other) : value(other.value) { copies++; }
+    CopyCounter(CopyCounter&& other) noexcept : value(other.value) {}
+    CopyCounter& operator=(const CopyCounter& other) { value = other.value; copies++; return *this; }
+    CopyCounter& operator=(CopyCounter&& other) noexcept { value = other.value; return *this; }
+};
+int CopyCounter::copies = 0;
+}
+
+TEST(QueueTest, MoveInAndTryPopWithoutCopies) {
+    Queue<CopyCounter> queue;
+    CopyCounter::copies = 0;
+    queue.enqueue(CopyCounter(1));
+    queue.emplace(2);
+    CopyCounter out;
+    EXPECT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.value, 1);
+    EXPECT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.value, 2);
+    EXPECT_FALSE(queue.tryPop(out));
+    EXPECT_EQ(CopyCounter::copies, 0);
+}
+
+TEST(QueueTest, BulkEnqueueAndDequeue) {
+    Queue<int> queue;
+    int values[] = {1, 2, 3, 4, 5};
+    queue.enqueue(0);
+    queue.enqueueRange(values, values + 5);
+    EXPECT_EQ(queue.getSize(), 6);
+    EXPECT_EQ(queue.back(), 5);
+
+    int out[4];
+    EXPECT_EQ(queue.dequeueInto(out, 4), 4);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[3], 3);
+    EXPECT_EQ(queue.dequeueInto(out, 4), 2);
+    EXPECT_EQ(out[1], 5);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_THROW(queue.back(), std::runtime_error);
+}
+
+// ==============================
+// NodePool Tests
+// ==============================
+TEST(NodePoolTest, PooledContainersBehaveLikeDefault) {
+    ForwardList<int, PooledNodeAllocator<>> flist;
+    DoubleList<int, PooledNodeAllocator<>> dlist;
+    Stack<int, PooledNodeAllocator<>> stack;
+    for (int i = 0; i < 5; i++) {
+        flist.pushBack(i);
+        dlist.pushFront(i);
+        stack.push(i);
+    }
+    flist.removeValue(2);
+    dlist.remove(1);
+    EXPECT_EQ(flist.getSize(), 4);
+    EXPECT_EQ(dlist.get(1), 2);
+    EXPECT_EQ(stack.top(), 4);
+
+    ForwardList<int, PooledNodeAllocator<>> copy(flist);
+    EXPECT_EQ(copy.get(2), 3);
+}
+
+TEST(NodePoolTest, SteadyStateChurnDoesNotAllocate) {
+    Queue<int, PooledNodeAllocator<>> queue;
+    for (int i = 0; i < 16; i++) {
+        queue.enqueue(i);
+    }
+    queue.dequeue(); // прогрев кеша пула
+
+    NodeAllocStats::reset();
+    for (int i = 0; i < 10000; i++) {
+        queue.enqueue(i);
+        queue.dequeue();
+    }
+    EXPECT_EQ(NodeAllocStats::allocations(), 0);
+    EXPECT_EQ(NodeAllocStats::deallocations(), 0);
+    EXPECT_EQ(queue.getSize(), 15);
+}
+
+TEST(NodePoolTest, ReleaseAfterThreadPoolDestroyed) {
+    std::thread worker([] {
+        // Очередь создана раньше пула потока, поэтому разрушается позже него:
+        // ее узлы должны уйти напрямую в глобальный аллокатор
+        thread_local Queue<int, PooledNodeAllocator<>> outlives_pool;
+        for (int i = 0; i < 100; i++) outlives_pool.enqueue(i);
+        for (int i = 0; i < 50; i++) outlives_pool.dequeue();
+    });
+    worker.join();
+    SUCCEED();
+}
+
+// ==============================
+// PersistentQueue Tests
+// ==============================
+TEST(PersistentQueueTest, EnqueueDequeueAcrossSegments) {
+    std::string dir = "test_pqueue_segments";
+    std::filesystem::remove_all(dir);
+    {
+        PersistentQueue<int> queue(dir, 4);
+        for (int i = 0; i < 10; i++) {
+            queue.enqueue(i);
+        }
+        EXPECT_EQ(queue.getSize(), 10);
+        EXPECT_EQ(queue.front(), 0);
+        EXPECT_EQ(queue.back(), 9);
+        EXPECT_EQ(queue.getSegmentCount(), 3);
+
+        for (int i = 0; i < 10; i++) {
+            EXPECT_EQ(queue.front(), i);
+            queue.dequeue();
+        }
+        EXPECT_TRUE(queue.isEmpty());
+        EXPECT_THROW(queue.dequeue(), std::runtime_error);
+    }
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PersistentQueueTest, ReopenRestoresState) {
+    std::string dir = "test_pqueue_reopen";
+    std::filesystem::remove_all(dir);
+    {
+        PersistentQueue<int> queue(dir, 4);
+        for (int i = 0; i < 7; i++) {
+            queue.enqueue(i);
+        }
+        queue.dequeue();
+        queue.dequeue();
+    }
+    std::ofstream(dir + "/notes.seg") << "not a segment"; // посторонний файл пропускается
+    {
+        PersistentQueue<int> queue(dir, 4);
+        EXPECT_TRUE(std::filesystem::exists(dir + "/notes.seg"));
+        EXPECT_EQ(queue.getSize(), 5);
+        EXPECT_EQ(queue.front(), 2);
+        EXPECT_EQ(queue.back(), 6);
+        queue.enqueue(7);
+        EXPECT_EQ(queue.back(), 7);
+    }
+    EXPECT_THROW(PersistentQueue<int>(dir, 8), std::runtime_error);
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PersistentQueueTest, ConsumedSegmentsAreRecycled) {
+    std::string dir = "test_pqueue_recycle";
+    std::filesystem::remove_all(dir);
+    {
+        PersistentQueue<int> queue(dir, 4);
+        for (int i = 0; i < 1000; i++) {
+            queue.enqueue(i);
+            queue.dequeue();
+        }
+        EXPECT_TRUE(queue.isEmpty());
+        size_t files = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            (void)entry;
+            files++;
+        }
+        EXPECT_LE(files, 4); // метаданные + текущий сегмент + запасные
+    }
+    std::filesystem::remove_all(dir);
+}
+
+// ==============================
+// DelayQueue Tests
+// ==============================
+TEST(DelayQueueTest, ItemsBecomeVisibleAfterDeadline) {
+    DelayQueue<int> queue;
+    queue.schedule(30, 300);
+    queue.schedule(10, 100);
+    queue.schedule(20, 200);
+    EXPECT_EQ(queue.getSize(), 3);
+    EXPECT_EQ(queue.nextDeadline(), 100);
+
+    int out[4];
+    EXPECT_EQ(queue.pollReady(50, out, 4), 0);
+    EXPECT_FALSE(queue.hasReady(99));
+    EXPECT_EQ(queue.pollReady(200, out, 4), 2);
+    EXPECT_EQ(out[0], 10);
+    EXPECT_EQ(out[1], 20);
+    EXPECT_EQ(queue.getSize(), 1);
+    EXPECT_EQ(queue.front(), 30);
+}
+
+TEST(DelayQueueTest, BatchLimitAndStableOrder) {
+    DelayQueue<int> queue;
+    for (int i = 0; i < 10; i++) {
+        queue.schedule(i, 5);
+    }
+    int out[10];
+    EXPECT_EQ(queue.pollReady(5, out, 4), 4);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(out[i], i);
+    }
+    EXPECT_EQ(queue.pollReady(5, out, 10), 6);
+    EXPECT_EQ(out[0], 4);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_THROW(queue.nextDeadline(), std::runtime_error);
+}
+
 // ==============================
 // Stack Tests
 // ==============================
@@ -284,6 +1438,21 @@ TEST(HashTableTest, Rehashing) {
     EXPECT_EQ(table.get(500), 5000);
 }
 
+TEST(HashTableTest, Swap) {
+    HashTable<int, int> small;
+    small.insert(1, 10);
+    HashTable<int, int> large;
+    for (int i = 0; i < 100; i++) large.insert(i, -i);
+
+    small.swap(large);
+    EXPECT_EQ(small.getSize(), 100);
+    EXPECT_EQ(small.get(99), -99);
+    EXPECT_EQ(large.getSize(), 1);
+    EXPECT_EQ(large.get(1), 10);
+    large.insert(2, 20); // таблица после обмена остается рабочей
+    EXPECT_TRUE(large.find(2));
+}
+
 // ==============================
 // FullBinaryTree Tests
 // ==============================
@@ -339,6 +1508,416 @@ TEST(FullBinaryTreeTest, InvariantMaintenance) {
     }
 }
 
+TEST(FullBinaryTreeTest, FrontierSurvivesRemoveAndClear) {
+    FullBinaryTree<int> tree;
+    ImplicitFullBinaryTree<int> reference; // та же форма и семантика удаления
+    for (int i = 1; i <= 15; i++) {
+        tree.insert(i);
+        reference.insert(i);
+    }
+    for (int value : {3, 15, 1, 7, 42}) { // лист, последняя пара, корень, внутренний, отсутствующий
+        tree.remove(value);
+        reference.remove(value);
+        ASSERT_TRUE(tree.isFullBinaryTree());
+    }
+    for (int i = 20; i < 25; i++) {
+        tree.insert(i);
+        reference.insert(i);
+    }
+    EXPECT_EQ(tree.getSize(), reference.getSize());
+
+    testing::internal::CaptureStdout();
+    tree.print();
+    std::string expected_output = testing::internal::GetCapturedStdout();
+    testing::internal::CaptureStdout();
+    reference.print();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), expected_output);
+
+    FullBinaryTree<int> copy(tree);
+    tree.clear();
+    tree.insert(1);
+    tree.insert(2);
+    EXPECT_EQ(tree.getSize(), 3);
+    copy.insert(99);
+    EXPECT_EQ(copy.getSize(), reference.getSize() + 2);
+    EXPECT_TRUE(copy.isFullBinaryTree());
+}
+
+TEST(FullBinaryTreeTest, DeserializeRejectsTreeNotFilledInLevelOrder) {
+    // Лист 2 стоит в обходе в ширину раньше внутреннего узла 3
+    std::stringstream text("5\n1 2 null null 3 4 null null 5 null null\n");
+    FullBinaryTree<int> tree;
+    EXPECT_THROW(tree.deserializeText(text), std::runtime_error);
+    EXPECT_TRUE(tree.isEmpty());
+
+    std::stringstream valid("5\n1 2 4 null null 5 null null 3 null null\n");
+    tree.deserializeText(valid);
+    tree.insert(6); // расширяется первый лист в порядке обхода — узел 3
+    testing::internal::CaptureStdout();
+    tree.print();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "Level-order traversal: 1 2 3 4 5 6 6 \n");
+}
+
+TEST(FullBinaryTreeTest, IndexedMatchesScanningTree) {
+    FullBinaryTree<int> plain;
+    FullBinaryTree<int, true> indexed;
+    std::mt19937 rng(11);
+    for (int step = 0; step < 400; step++) {
+        int value = static_cast<int>(rng() % 50);
+        if (rng() % 3 == 0) {
+            plain.remove(value);
+            indexed.remove(value);
+        } else {
+            plain.insert(value);
+            indexed.insert(value);
+        }
+        ASSERT_EQ(indexed.getSize(), plain.getSize());
+    }
+    for (int value = 0; value < 50; value++) {
+        EXPECT_EQ(indexed.find(value), plain.find(value)) << "value " << value;
+    }
+    testing::internal::CaptureStdout();
+    plain.print();
+    std::string expected = testing::internal::GetCapturedStdout();
+    testing::internal::CaptureStdout();
+    indexed.print();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), expected);
+}
+
+TEST(FullBinaryTreeTest, IndexedRebuiltOnCopyAndDeserialize) {
+    FullBinaryTree<int, true> tree;
+    for (int i = 1; i <= 6; i++) tree.insert(i);
+    FullBinaryTree<int, true> copy(tree);
+    tree.clear();
+    EXPECT_FALSE(tree.find(3));
+    EXPECT_TRUE(copy.find(3));
+    copy.remove(3);
+    copy.remove(3);
+    EXPECT_FALSE(copy.find(3));
+
+    FullBinaryTree<int, true> assigned;
+    assigned.insert(99);
+    assigned = copy; // индекс копии переходит обменом, без перестроения
+    EXPECT_FALSE(assigned.find(99));
+    EXPECT_TRUE(assigned.find(5));
+    assigned.remove(5);
+    assigned.remove(5);
+    EXPECT_FALSE(assigned.find(5));
+    EXPECT_TRUE(copy.find(5));
+
+    std::stringstream ss;
+    copy.serialize(ss);
+    FullBinaryTree<int, true> restored;
+    restored.deserialize(ss);
+    EXPECT_TRUE(restored.find(6));
+    EXPECT_FALSE(restored.find(3));
+    restored.remove(1);
+    EXPECT_FALSE(restored.find(1));
+    EXPECT_TRUE(restored.isFullBinaryTree());
+}
+
+TEST(FullBinaryTreeTest, DeepSkewedInputParsedWithoutRecursion) {
+    // Левая "гребенка" глубины DEPTH: рекурсивный разбор переполнил бы стек
+    const int DEPTH = 200000;
+    std::string preorder;
+    preorder.reserve(DEPTH * 16);
+    for (int i = 0; i < DEPTH; i++) preorder += "1 ";
+    preorder += "2 null null ";
+    for (int i = 0; i < DEPTH; i++) preorder += "3 null null ";
+    std::stringstream text(std::to_string(2 * DEPTH + 1) + "\n" + preorder + "\n");
+
+    FullBinaryTree<int> tree;
+    EXPECT_THROW(tree.deserializeText(text), std::runtime_error); // форма не заполнена по уровням
+    EXPECT_TRUE(tree.isEmpty());
+}
+
+TEST(FullBinaryTreeTest, LargeTreeCopyAndRoundTrip) {
+    FullBinaryTree<int> tree;
+    for (int i = 0; i < 50000; i++) tree.insert(i);
+    FullBinaryTree<int> copy(tree);
+    FullBinaryTree<int> assigned;
+    assigned.insert(7);
+    assigned = tree;
+    copy.insert(-1);
+    EXPECT_EQ(assigned.getSize(), tree.getSize());
+    EXPECT_EQ(copy.getSize(), tree.getSize() + 2);
+    EXPECT_TRUE(copy.isFullBinaryTree());
+
+    std::stringstream binary;
+    tree.serializeBinary(binary);
+    std::string bytes = binary.str();
+    FullBinaryTree<int> restored;
+    std::stringstream full(bytes);
+    restored.deserializeBinary(full);
+    EXPECT_EQ(restored.getSize(), tree.getSize());
+    EXPECT_TRUE(restored.find(49999));
+
+    std::stringstream text;
+    tree.serializeText(text);
+    restored.deserializeText(text);
+    EXPECT_EQ(restored.getSize(), tree.getSize());
+
+    // Оборванный поток дает узел с одним потомком и отвергается
+    std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+    EXPECT_THROW(restored.deserializeBinary(truncated), std::runtime_error);
+    EXPECT_TRUE(restored.isEmpty());
+}
+
+TEST(FullBinaryTreeTest, ArenaAllocatesInChunksAndReleasesAtOnce) {
+    FullBinaryTree<int> tree;
+    NodeAllocStats::reset();
+    for (int i = 0; i < 10000; i++) tree.insert(i);
+    size_t chunk_allocations = NodeAllocStats::allocations();
+    EXPECT_LT(chunk_allocations, 20u); // блоки растут, а не узел на вставку
+
+    for (int i = 0; i < 100; i++) tree.remove(i);
+    for (int i = 0; i < 100; i++) tree.insert(i);
+    EXPECT_EQ(NodeAllocStats::allocations(), chunk_allocations); // освобожденные узлы переиспользованы
+
+    tree.clear();
+    EXPECT_EQ(NodeAllocStats::deallocations(), chunk_allocations);
+    tree.insert(1);
+    EXPECT_TRUE(tree.find(1));
+}
+
+TEST(FullBinaryTreeTest, ArenaRunsDestructorsForNonTrivialValues) {
+    FullBinaryTree<std::string> tree;
+    const std::string long_value(100, 'x'); // строка вне SSO: утечка была бы видна санитайзеру
+    for (int i = 0; i < 50; i++) tree.insert(long_value + std::to_string(i));
+    tree.remove(long_value + "3");
+    tree.remove(long_value + "3"); // вставка добавляет пару одинаковых листьев
+    EXPECT_FALSE(tree.find(long_value + "3"));
+
+    FullBinaryTree<std::string> assigned;
+    assigned.insert("old");
+    assigned = tree;
+    tree.clear();
+    EXPECT_EQ(assigned.getSize(), 95u);
+    EXPECT_TRUE(assigned.find(long_value + "49") || assigned.find(long_value + "48"));
+    EXPECT_TRUE(assigned.isFullBinaryTree());
+}
+
+TEST(FullBinaryTreeTest, ParallelReduceAndForEachMatchSequential) {
+    FullBinaryTree<int> tree;
+    EXPECT_EQ(tree.parallelReduce(0LL, [](int v) { return static_cast<long long>(v); },
+                                  [](long long a, long long b) { return a + b; }, 4), 0);
+    EXPECT_FALSE(tree.parallelFind(1, 4));
+
+    const int N = 40000; // несколько диапазонов по MIN_PARALLEL_RANGE узлов
+    for (int i = 0; i < N; i++) tree.insert(i);
+    long long expected = 0;
+    for (int i = 1; i < N; i++) expected += 2LL * i;
+
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        long long sum = tree.parallelReduce(0LL, [](int v) { return static_cast<long long>(v); },
+                                            [](long long a, long long b) { return a + b; }, threads);
+        EXPECT_EQ(sum, expected) << "threads " << threads;
+
+        std::atomic<size_t> visited{0};
+        tree.parallelForEach([&visited](const int&) { visited.fetch_add(1); }, threads);
+        EXPECT_EQ(visited.load(), tree.getSize());
+    }
+    bool any_negative = tree.parallelReduce(false, [](int v) { return v < 0; },
+                                            [](bool a, bool b) { return a || b; }, 4);
+    EXPECT_FALSE(any_negative);
+
+    // Частичные результаты выделяются по числу задач, а не по запрошенному числу потоков
+    const unsigned MANY_THREADS = std::numeric_limits<unsigned>::max();
+    long long capped = tree.parallelReduce(0LL, [](int v) { return static_cast<long long>(v); },
+                                           [](long long a, long long b) { return a + b; }, MANY_THREADS);
+    EXPECT_EQ(capped, expected);
+}
+
+TEST(FullBinaryTreeTest, ParallelFindAndExceptionPropagation) {
+    FullBinaryTree<int> tree;
+    for (int i = 0; i < 40000; i++) tree.insert(i);
+    EXPECT_TRUE(tree.parallelFind(0, 4));
+    EXPECT_TRUE(tree.parallelFind(39999, 4));
+    EXPECT_FALSE(tree.parallelFind(-1, 4));
+    EXPECT_TRUE(tree.parallelFind(20000));
+
+    EXPECT_THROW(tree.parallelForEach([](const int& v) {
+        if (v == 39990) throw std::runtime_error("stop");
+    }, 4), std::runtime_error);
+}
+
+namespace {
+// Эталонные рекурсивные обходы по кучевой нумерации (потомки i — 2i+1 и 2i+2)
+void referenceOrder(const ImplicitFullBinaryTree<int>& tree, size_t i, int order, std::vector<int>& out) {
+    if (i >= tree.getSize()) return;
+    if (order == 0) out.push_back(tree.get(i));
+    referenceOrder(tree, ImplicitFullBinaryTree<int>::leftChild(i), order, out);
+    if (order == 1) out.push_back(tree.get(i));
+    referenceOrder(tree, ImplicitFullBinaryTree<int>::rightChild(i), order, out);
+    if (order == 2) out.push_back(tree.get(i));
+}
+
+template<typename Range>
+std::vector<int> collect(const Range& range) {
+    std::vector<int> values;
+    for (int v : range) values.push_back(v);
+    return values;
+}
+}
+
+TEST(FullBinaryTreeTest, StacklessTraversalsMatchRecursiveOrder) {
+    FullBinaryTree<int> tree;
+    ImplicitFullBinaryTree<int> shape;
+    for (int i = 1; i <= 23; i++) { // неполный последний уровень
+        tree.insert(i * 10 + i % 3);
+        shape.insert(i * 10 + i % 3);
+    }
+    std::vector<int> pre, in, post, level;
+    referenceOrder(shape, 0, 0, pre);
+    referenceOrder(shape, 0, 1, in);
+    referenceOrder(shape, 0, 2, post);
+    for (size_t i = 0; i < shape.getSize(); i++) level.push_back(shape.get(i));
+
+    EXPECT_EQ(collect(tree.preOrderRange()), pre);
+    EXPECT_EQ(collect(tree.inOrderRange()), in);
+    EXPECT_EQ(collect(tree.postOrderRange()), post);
+    EXPECT_EQ(collect(tree.levelOrderRange()), level);
+    EXPECT_EQ(collect(tree), level);
+}
+
+TEST(FullBinaryTreeTest, TraversalEdgeCases) {
+    FullBinaryTree<int> tree;
+    EXPECT_TRUE(tree.begin() == tree.end());
+    EXPECT_TRUE(tree.inOrderRange().begin() == tree.inOrderRange().end());
+    EXPECT_TRUE(tree.postOrderRange().begin() == tree.postOrderRange().end());
+
+    tree.insert(5);
+    EXPECT_EQ(collect(tree.preOrderRange()), std::vector<int>{5});
+    EXPECT_EQ(collect(tree.postOrderRange()), std::vector<int>{5});
+
+    tree.insert(7);
+    auto it = tree.inOrderRange().begin();
+    EXPECT_EQ(*it++, 7);
+    EXPECT_EQ(*it, 5);
+    EXPECT_EQ(std::distance(tree.postOrderRange().begin(), tree.postOrderRange().end()), 3);
+
+    int sum = 0;
+    for (int v : tree.preOrderRange()) sum += v;
+    EXPECT_EQ(sum, 19);
+}
+
+TEST(FullBinaryTreeTest, SuccinctRoundTripIsSmaller) {
+    FullBinaryTree<int> tree;
+    for (int i = 0; i < 1000; i++) tree.insert(i * 3);
+    std::stringstream succinct, binary;
+    tree.serializeSuccinct(succinct);
+    tree.serializeBinary(binary);
+    size_t n = tree.getSize();
+    EXPECT_EQ(succinct.str().size(), sizeof(size_t) + (n + 7) / 8 + n * sizeof(int));
+    EXPECT_LT(succinct.str().size(), binary.str().size());
+
+    FullBinaryTree<int, true> restored;
+    restored.deserializeSuccinct(succinct);
+    EXPECT_EQ(restored.getSize(), n);
+    EXPECT_EQ(collect(restored.preOrderRange()), collect(tree.preOrderRange()));
+    EXPECT_TRUE(restored.find(2997));
+    restored.insert(-1);
+    EXPECT_TRUE(restored.isFullBinaryTree());
+
+    FullBinaryTree<int> empty, empty_restored;
+    std::stringstream empty_stream;
+    empty.serializeSuccinct(empty_stream);
+    empty_restored.deserializeSuccinct(empty_stream);
+    EXPECT_TRUE(empty_restored.isEmpty());
+}
+
+TEST(FullBinaryTreeTest, SuccinctRejectsCorruptShape) {
+    FullBinaryTree<int> tree;
+    for (int i = 0; i < 4; i++) tree.insert(i); // 7 узлов, биты формы 0b0000111
+    std::stringstream ss;
+    tree.serializeSuccinct(ss);
+    std::string bytes = ss.str();
+
+    std::string too_many = bytes;
+    too_many[sizeof(size_t)] = static_cast<char>(0x0F); // у 4-го узла потомков уже не хватает
+    std::stringstream corrupt(too_many);
+    FullBinaryTree<int> restored;
+    EXPECT_THROW(restored.deserializeSuccinct(corrupt), std::runtime_error);
+    EXPECT_TRUE(restored.isEmpty());
+
+    std::string not_level_order = bytes;
+    not_level_order[sizeof(size_t)] = static_cast<char>(0x0B); // лист 2 раньше внутреннего 3
+    std::stringstream shuffled(not_level_order);
+    EXPECT_THROW(restored.deserializeSuccinct(shuffled), std::runtime_error);
+
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 2));
+    EXPECT_THROW(restored.deserializeSuccinct(truncated), std::runtime_error);
+
+    // Размер 3 и биты 0b010: внутренним назван еще не привязанный узел 1 (петля)
+    FullBinaryTree<int> small;
+    for (int i = 0; i < 2; i++) small.insert(i);
+    std::stringstream small_stream;
+    small.serializeSuccinct(small_stream);
+    std::string self_loop = small_stream.str();
+    self_loop[sizeof(size_t)] = static_cast<char>(0x02);
+    std::stringstream loop(self_loop);
+    EXPECT_THROW(restored.deserializeSuccinct(loop), std::runtime_error);
+    EXPECT_TRUE(restored.isEmpty());
+}
+
+// ==============================
+// ImplicitFullBinaryTree Tests
+// ==============================
+TEST(ImplicitFullBinaryTreeTest, SameShapeAsPointerTree) {
+    FullBinaryTree<int> pointer_tree;
+    ImplicitFullBinaryTree<int> implicit_tree;
+    for (int i = 1; i <= 20; i++) {
+        pointer_tree.insert(i);
+        implicit_tree.insert(i);
+        EXPECT_TRUE(implicit_tree.isFullBinaryTree());
+    }
+    EXPECT_EQ(implicit_tree.getSize(), pointer_tree.getSize());
+
+    // Обходы в ширину и симметричный совпадают с деревом на указателях
+    testing::internal::CaptureStdout();
+    pointer_tree.print();
+    pointer_tree.printInOrder();
+    std::string expected = testing::internal::GetCapturedStdout();
+    testing::internal::CaptureStdout();
+    implicit_tree.print();
+    implicit_tree.printInOrder();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), expected);
+
+    EXPECT_EQ(implicit_tree.get(0), 1);
+    EXPECT_EQ(implicit_tree.get(ImplicitFullBinaryTree<int>::leftChild(2)), 4);
+    EXPECT_EQ(ImplicitFullBinaryTree<int>::parent(6), 2u);
+    EXPECT_FALSE(implicit_tree.isLeaf(0));
+    EXPECT_TRUE(implicit_tree.isLeaf(implicit_tree.getSize() - 1));
+    EXPECT_THROW(implicit_tree.get(implicit_tree.getSize()), std::out_of_range);
+}
+
+TEST(ImplicitFullBinaryTreeTest, RemoveAndSerialization) {
+    ImplicitFullBinaryTree<int> tree;
+    for (int i = 1; i <= 5; i++) tree.insert(i); // 1 2 2 3 3 4 4 5 5
+    tree.remove(1);                               // корень замещается последним листом
+    EXPECT_EQ(tree.getSize(), 7);
+    EXPECT_EQ(tree.get(0), 5);
+    EXPECT_FALSE(tree.find(1));
+    tree.remove(4);                               // узел из последней пары
+    EXPECT_EQ(tree.getSize(), 5);
+    tree.remove(42);
+    EXPECT_EQ(tree.getSize(), 5);
+    EXPECT_TRUE(tree.isFullBinaryTree());
+
+    std::stringstream binary;
+    tree.serializeBinary(binary);
+    ImplicitFullBinaryTree<int> restored;
+    restored.deserializeBinary(binary);
+    EXPECT_EQ(restored.getSize(), 5);
+    EXPECT_EQ(restored.get(0), 5);
+
+    std::stringstream text("4\n1 2 3 4\n");
+    EXPECT_THROW(restored.deserializeText(text), std::runtime_error);
+
+    while (!tree.isEmpty()) tree.remove(tree.get(0));
+    EXPECT_EQ(tree.getSize(), 0);
+}
+
 // ==============================
 // File Serialization Tests
 // ==============================